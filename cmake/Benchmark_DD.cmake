@@ -0,0 +1,21 @@
+#
+# Loads the google benchmark library giving the priority to the system package first, with a fallback
+# to the FetchContent.
+#
+include_guard(GLOBAL)
+
+find_package(benchmark 1.7 QUIET GLOBAL)
+if(NOT benchmark_FOUND)
+    message(STATUS "benchmark v1.7.x package not found in the system. Falling back to FetchContent.")
+    include(FetchContent)
+
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+    FetchContent_Declare(
+            benchmark
+            GIT_REPOSITORY https://github.com/google/benchmark.git
+            GIT_TAG        v1.8.3
+    )
+    FetchContent_MakeAvailable(benchmark)
+endif()
@@ -0,0 +1,121 @@
+/**
+ * @file src/common/backoff_policy.cpp
+ * @brief Definitions for the backoff policies used by the RetryScheduler.
+ */
+// class header include
+#include "display_device/backoff_policy.h"
+
+// system includes
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief Validate the initial and maximum durations of the policy.
+     * @param initial The initial duration.
+     * @param max The maximum duration.
+     * @param policy Name of the policy for the error message.
+     */
+    void
+    validateRange(const std::chrono::milliseconds initial, const std::chrono::milliseconds max, const std::string &policy) {
+      if (initial <= std::chrono::milliseconds::zero()) {
+        throw std::logic_error { "Initial duration must be larger than 0 in " + policy + "!" };
+      }
+
+      if (max < initial) {
+        throw std::logic_error { "Maximum duration must not be smaller than the initial duration in " + policy + "!" };
+      }
+    }
+  }  // namespace
+
+  FixedBackoff::FixedBackoff(const std::chrono::milliseconds duration):
+      m_duration { duration > std::chrono::milliseconds::zero() ? duration : throw std::logic_error { "Duration must be larger than 0 in FixedBackoff!" } } {
+  }
+
+  std::chrono::milliseconds
+  FixedBackoff::next() {
+    return m_duration;
+  }
+
+  LinearBackoff::LinearBackoff(const std::chrono::milliseconds initial, const std::chrono::milliseconds step, const std::chrono::milliseconds max):
+      m_current { initial },
+      m_step { step },
+      m_max { max } {
+    validateRange(initial, max, "LinearBackoff");
+    if (step < std::chrono::milliseconds::zero()) {
+      throw std::logic_error { "Step must not be negative in LinearBackoff!" };
+    }
+  }
+
+  std::chrono::milliseconds
+  LinearBackoff::next() {
+    const auto result { m_current };
+    // Written this way so that the duration cannot overflow
+    m_current = m_max - m_current > m_step ? m_current + m_step : m_max;
+    return result;
+  }
+
+  ExponentialBackoff::ExponentialBackoff(const std::chrono::milliseconds initial, const std::chrono::milliseconds max, const double multiplier):
+      m_current { initial },
+      m_max { max },
+      m_multiplier { multiplier } {
+    validateRange(initial, max, "ExponentialBackoff");
+    if (!(multiplier >= 1.0)) {
+      throw std::logic_error { "Multiplier must not be smaller than 1 in ExponentialBackoff!" };
+    }
+  }
+
+  std::chrono::milliseconds
+  ExponentialBackoff::next() {
+    const auto result { m_current };
+    if (m_current < m_max) {
+      // Calculated in double, so that the duration cannot overflow
+      const auto next_count { static_cast<double>(m_current.count()) * m_multiplier };
+      m_current = next_count >= static_cast<double>(m_max.count()) ? m_max : std::chrono::milliseconds { static_cast<std::chrono::milliseconds::rep>(next_count) };
+    }
+    return result;
+  }
+
+  DecorrelatedJitterBackoff::DecorrelatedJitterBackoff(const std::chrono::milliseconds base, const std::chrono::milliseconds max, const std::uint32_t seed):
+      m_base { base },
+      m_max { max },
+      m_previous { base },
+      m_engine { seed } {
+    validateRange(base, max, "DecorrelatedJitterBackoff");
+  }
+
+  std::chrono::milliseconds
+  DecorrelatedJitterBackoff::next() {
+    const auto upper_bound { m_previous > m_max / 3 ? m_max : std::max(m_previous * 3, m_base) };
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> distribution { m_base.count(), upper_bound.count() };
+    m_previous = std::chrono::milliseconds { distribution(m_engine) };
+    return m_previous;
+  }
+
+  ListBackoff::ListBackoff(std::vector<std::chrono::milliseconds> durations):
+      m_durations { std::move(durations) } {
+    if (m_durations.empty()) {
+      throw std::logic_error { "At least 1 duration must be specified in ListBackoff!" };
+    }
+
+    if (std::ranges::any_of(m_durations, [](const auto &duration) { return duration <= std::chrono::milliseconds::zero(); })) {
+      throw std::logic_error { "All of the durations specified in ListBackoff must be larger than a 0!" };
+    }
+  }
+
+  std::chrono::milliseconds
+  ListBackoff::next() {
+    const auto result { m_durations[m_index] };
+    if (m_index + 1 < m_durations.size()) {
+      ++m_index;
+    }
+    return result;
+  }
+
+  std::chrono::milliseconds
+  takeNextDuration(BackoffPolicy &policy) {
+    return std::visit([](auto &value) { return value.next(); }, policy);
+  }
+}  // namespace display_device
@@ -26,7 +26,7 @@ namespace display_device {
     try {
       std::ofstream stream { m_filepath, std::ios::binary | std::ios::trunc };
       if (!stream) {
-        DD_LOG(error) << "Failed to open " << m_filepath << " for writing!";
+        DD_LOG_CH(persistence, error) << "Failed to open " << m_filepath << " for writing!";
         return false;
       }
 
@@ -34,8 +34,8 @@ namespace display_device {
       return true;
     }
     catch (const std::exception &error) {
-      DD_LOG(error) << "Failed to write to " << m_filepath << "! Error:\n"
-                    << error.what();
+      DD_LOG_CH(persistence, error) << "Failed to write to " << m_filepath << "! Error:\n"
+                                    << error.what();
       return false;
     }
   }
@@ -44,8 +44,8 @@ namespace display_device {
   FileSettingsPersistence::load() const {
     if (std::error_code error_code; !std::filesystem::exists(m_filepath, error_code)) {
       if (error_code) {
-        DD_LOG(error) << "Failed to load " << m_filepath << "! Error:\n"
-                      << "[" << error_code.value() << "] " << error_code.message();
+        DD_LOG_CH(persistence, error) << "Failed to load " << m_filepath << "! Error:\n"
+                                      << "[" << error_code.value() << "] " << error_code.message();
         return std::nullopt;
       }
 
@@ -55,7 +55,7 @@ namespace display_device {
     try {
       std::ifstream stream { m_filepath, std::ios::binary };
       if (!stream) {
-        DD_LOG(error) << "Failed to open " << m_filepath << " for reading!";
+        DD_LOG_CH(persistence, error) << "Failed to open " << m_filepath << " for reading!";
         return std::nullopt;
       }
 
@@ -63,8 +63,8 @@ namespace display_device {
         std::istreambuf_iterator<char> {} };
     }
     catch (const std::exception &error) {
-      DD_LOG(error) << "Failed to read " << m_filepath << "! Error:\n"
-                    << error.what();
+      DD_LOG_CH(persistence, error) << "Failed to read " << m_filepath << "! Error:\n"
+                                    << error.what();
       return std::nullopt;
     }
   }
@@ -76,8 +76,8 @@ namespace display_device {
     std::filesystem::remove(m_filepath, error_code);
 
     if (error_code) {
-      DD_LOG(error) << "Failed to remove " << m_filepath << "! Error:\n"
-                    << "[" << error_code.value() << "] " << error_code.message();
+      DD_LOG_CH(persistence, error) << "Failed to remove " << m_filepath << "! Error:\n"
+                                    << "[" << error_code.value() << "] " << error_code.message();
       return false;
     }
 
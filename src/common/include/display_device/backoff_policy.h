@@ -0,0 +1,154 @@
+/**
+ * @file src/common/include/display_device/backoff_policy.h
+ * @brief Declarations for the backoff policies used by the RetryScheduler.
+ */
+#pragma once
+
+// system includes
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <variant>
+#include <vector>
+
+namespace display_device {
+  /**
+   * @brief Always returns the same duration.
+   */
+  class FixedBackoff final {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param duration The duration. Throws if it is not larger than 0.
+     */
+    explicit FixedBackoff(std::chrono::milliseconds duration);
+
+    /**
+     * @brief Get the next duration.
+     * @returns The duration.
+     */
+    [[nodiscard]] std::chrono::milliseconds
+    next();
+
+  private:
+    std::chrono::milliseconds m_duration;
+  };
+
+  /**
+   * @brief Increases the duration by the same step on every call, up to the maximum.
+   */
+  class LinearBackoff final {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param initial The first duration. Throws if it is not larger than 0.
+     * @param step Duration added on every call.
+     * @param max The maximum duration. Throws if it is smaller than the initial duration.
+     */
+    explicit LinearBackoff(std::chrono::milliseconds initial, std::chrono::milliseconds step, std::chrono::milliseconds max);
+
+    /**
+     * @brief Get the next duration.
+     * @returns The duration.
+     */
+    [[nodiscard]] std::chrono::milliseconds
+    next();
+
+  private:
+    std::chrono::milliseconds m_current;
+    std::chrono::milliseconds m_step;
+    std::chrono::milliseconds m_max;
+  };
+
+  /**
+   * @brief Multiplies the duration on every call, up to the maximum.
+   */
+  class ExponentialBackoff final {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param initial The first duration. Throws if it is not larger than 0.
+     * @param max The maximum duration. Throws if it is smaller than the initial duration.
+     * @param multiplier Multiplier applied on every call. Throws if it is smaller than 1.
+     */
+    explicit ExponentialBackoff(std::chrono::milliseconds initial, std::chrono::milliseconds max, double multiplier = 2.0);
+
+    /**
+     * @brief Get the next duration.
+     * @returns The duration.
+     */
+    [[nodiscard]] std::chrono::milliseconds
+    next();
+
+  private:
+    std::chrono::milliseconds m_current;
+    std::chrono::milliseconds m_max;
+    double m_multiplier;
+  };
+
+  /**
+   * @brief Returns a random duration between the base and 3 times the previous duration, up to the maximum.
+   *
+   * This is the "decorrelated jitter" backoff that spreads out the retries of many schedulers
+   * failing at the same time.
+   */
+  class DecorrelatedJitterBackoff final {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param base The minimum (and the first upper bound) duration. Throws if it is not larger than 0.
+     * @param max The maximum duration. Throws if it is smaller than the base duration.
+     * @param seed Seed for the random number generator.
+     */
+    explicit DecorrelatedJitterBackoff(std::chrono::milliseconds base, std::chrono::milliseconds max, std::uint32_t seed = std::random_device {}());
+
+    /**
+     * @brief Get the next duration.
+     * @returns The duration.
+     */
+    [[nodiscard]] std::chrono::milliseconds
+    next();
+
+  private:
+    std::chrono::milliseconds m_base;
+    std::chrono::milliseconds m_max;
+    std::chrono::milliseconds m_previous;
+    std::minstd_rand m_engine;
+  };
+
+  /**
+   * @brief Returns the durations from the list one by one, the last duration is reused indefinitely.
+   */
+  class ListBackoff final {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param durations The durations. Throws if the list is empty or any of the durations is not larger than 0.
+     */
+    explicit ListBackoff(std::vector<std::chrono::milliseconds> durations);
+
+    /**
+     * @brief Get the next duration.
+     * @returns The duration.
+     */
+    [[nodiscard]] std::chrono::milliseconds
+    next();
+
+  private:
+    std::vector<std::chrono::milliseconds> m_durations;
+    std::size_t m_index { 0 };
+  };
+
+  /**
+   * @brief Any of the backoff policies.
+   */
+  using BackoffPolicy = std::variant<FixedBackoff, LinearBackoff, ExponentialBackoff, DecorrelatedJitterBackoff, ListBackoff>;
+
+  /**
+   * @brief Get the next duration from the policy.
+   * @param policy Policy to advance.
+   * @returns The duration.
+   */
+  [[nodiscard]] std::chrono::milliseconds
+  takeNextDuration(BackoffPolicy &policy);
+}  // namespace display_device
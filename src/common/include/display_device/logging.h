@@ -5,11 +5,37 @@
 #pragma once
 
 // system includes
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <iomanip>
+#include <ios>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief The minimum log level (as an integer value of `Logger::LogLevel`) that is compiled in.
+ *
+ * Log statements below this level are removed at compile time (including their argument expressions).
+ * It is normally set via the `DD_LOG_MIN_LEVEL` CMake cache variable.
+ */
+#ifndef DD_LOG_MIN_LEVEL
+  #define DD_LOG_MIN_LEVEL 0
+#endif
 
 namespace display_device {
+  class LogRecord;
+  class LogDedupPayload;
+
   /**
    * @brief A singleton class for logging or re-routing logs.
    *
@@ -34,10 +60,59 @@ namespace display_device {
       fatal  ///< Fatal level
     };
 
+    /**
+     * @brief Defines the log channels (subsystems) that have independent log levels.
+     * @note All channels are in lower-case on purpose to fit the "DD_LOG_CH(winapi, info)" style.
+     */
+    enum class LogChannel {
+      general = 0,  ///< Everything that does not belong to a specific channel
+      winapi,  ///< Low-level OS API layer
+      display,  ///< Display device layer
+      settings,  ///< Settings manager and its utilities
+      persistence,  ///< Settings persistence
+      scheduler  ///< RetryScheduler
+    };
+
     /**
      * @brief Defines the callback type for log data re-routing.
+     * @note The string view is only valid during the callback (it refers to a reused thread-local buffer).
+     */
+    using Callback = std::function<void(LogLevel, std::string_view)>;
+
+    /**
+     * @brief Defines the callback type for structured log data re-routing.
+     *
+     * Unlike the `Callback`, the record is passed without any text formatting
+     * applied to it. It can still be formatted via `LogRecord::format` if needed.
      */
-    using Callback = std::function<void(LogLevel, std::string)>;
+    using RecordCallback = std::function<void(const LogRecord &)>;
+
+    /**
+     * @brief Defines what happens to a new log record when the asynchronous queue is full.
+     */
+    enum class OverflowPolicy {
+      Drop,  ///< The new record is silently discarded.
+      Block,  ///< The producing thread waits until there is space in the queue.
+      CountAndDrop  ///< The new record is discarded, but the number of dropped records is reported by the background thread.
+    };
+
+    /**
+     * @brief Options for the asynchronous logging mode.
+     */
+    struct AsyncOptions {
+      std::size_t m_capacity { 1024 };  ///< Maximum number of queued records (rounded up to the power of 2).
+      OverflowPolicy m_overflow_policy { OverflowPolicy::Block };  ///< Policy to be used when the queue is full.
+    };
+
+    /**
+     * @brief Options for the flight recorder.
+     */
+    struct FlightRecorderOptions {
+      std::size_t m_capacity { 256 };  ///< Number of the most recent records to keep (rounded up to the power of 2).
+      std::size_t m_record_size { 512 };  ///< Maximum size of the captured record data in bytes (longer records are truncated).
+      LogLevel m_capture_level { LogLevel::verbose };  ///< The lowest level to be captured.
+      bool m_dump_on_error { true };  ///< Dump the recorder automatically before writing out an error (or fatal) record.
+    };
 
     /**
      * @brief Get the singleton instance.
@@ -50,7 +125,7 @@ namespace display_device {
     get();
 
     /**
-     * @brief Set the log level for the logger.
+     * @brief Set the log level for all the channels.
      * @param log_level New level to be used.
      * @examples
      * Logger::get().setLogLevel(Logger::LogLevel::Info);
@@ -60,21 +135,77 @@ namespace display_device {
     setLogLevel(LogLevel log_level);
 
     /**
-     * @brief Check if log level is currently enabled.
+     * @brief Set the log level for a single channel.
+     * @param channel Channel to set the level for.
+     * @param log_level New level to be used.
+     * @examples
+     * Logger::get().setLogLevel(Logger::LogLevel::info);
+     * Logger::get().setLogLevel(Logger::LogChannel::winapi, Logger::LogLevel::verbose);
+     * @examples_end
+     */
+    void
+    setLogLevel(LogChannel channel, LogLevel log_level);
+
+    /**
+     * @brief Check if log level is currently enabled for the general channel.
      * @param log_level Log level to check.
      * @returns True if log level is enabled.
+     * @note This method does not need the singleton instance, so that it can be cheaply used in the `DD_LOG` macro.
      * @examples
-     * const bool is_enabled { Logger::get().isLogLevelEnabled(Logger::LogLevel::Info) };
+     * const bool is_enabled { Logger::isLogLevelEnabled(Logger::LogLevel::Info) };
      * @examples_end
      */
-    [[nodiscard]] bool
-    isLogLevelEnabled(LogLevel log_level) const;
+    [[nodiscard]] static bool
+    isLogLevelEnabled(LogLevel log_level) {
+      return isLogLevelEnabled(LogChannel::general, log_level);
+    }
+
+    /**
+     * @brief Check if log level is currently enabled for the channel.
+     * @param channel Channel to check.
+     * @param log_level Log level to check.
+     * @returns True if log level is enabled.
+     * @examples
+     * const bool is_enabled { Logger::isLogLevelEnabled(Logger::LogChannel::winapi, Logger::LogLevel::verbose) };
+     * @examples_end
+     */
+    [[nodiscard]] static bool
+    isLogLevelEnabled(LogChannel channel, LogLevel log_level) {
+      const auto &enabled_log_level { m_channel_log_levels[static_cast<std::size_t>(channel)].m_log_level };
+      return static_cast<int>(log_level) >= static_cast<int>(enabled_log_level.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Check if the log statement needs to be captured at all (either for the output or for the flight recorder).
+     * @param channel Channel to check.
+     * @param log_level Log level to check.
+     * @returns True if the statement needs to be captured.
+     * @note This is the check used by the `DD_LOG_CH` macro.
+     */
+    [[nodiscard]] static bool
+    isLogLevelCaptured(LogChannel channel, LogLevel log_level) {
+      const auto &capture_level { m_channel_log_levels[static_cast<std::size_t>(channel)].m_capture_level };
+      return static_cast<int>(log_level) >= static_cast<int>(capture_level.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Check if log level is compiled in (see `DD_LOG_MIN_LEVEL`).
+     * @param log_level Log level to check.
+     * @returns True if log level is compiled in.
+     * @examples
+     * static_assert(Logger::isLogLevelCompiledIn(Logger::LogLevel::fatal));
+     * @examples_end
+     */
+    [[nodiscard]] static constexpr bool
+    isLogLevelCompiledIn(LogLevel log_level) {
+      return static_cast<int>(log_level) >= DD_LOG_MIN_LEVEL;
+    }
 
     /**
      * @brief Set custom callback for writing the logs.
      * @param callback New callback to be used or nullptr to reset to the default.
      * @examples
-     * Logger::get().setCustomCallback([](const LogLevel level, std::string value){
+     * Logger::get().setCustomCallback([](const LogLevel level, std::string_view value){
      *    // write to file or something
      * });
      * @examples_end
@@ -82,16 +213,141 @@ namespace display_device {
     void
     setCustomCallback(Callback callback);
 
+    /**
+     * @brief Set custom callback for receiving the structured log records.
+     * @param callback New callback to be used or nullptr to reset to the default.
+     * @note The record callback and the text callback (see `setCustomCallback`) are mutually
+     *       exclusive - setting one of them resets the other.
+     * @examples
+     * Logger::get().setCustomRecordCallback([](const LogRecord &record){
+     *    record.visit([](const auto &value) {
+     *      // serialize the value to some binary format or something
+     *    });
+     * });
+     * @examples_end
+     */
+    void
+    setCustomRecordCallback(RecordCallback callback);
+
     /**
      * @brief Write the string to the output (via callback) if the log level is enabled.
      * @param log_level Log level to be checked and (probably) written.
-     * @param value A copy of the string to be written.
+     * @param value The string to be written.
      * @examples
      * Logger::get().write(Logger::LogLevel::Info, "Hello World!");
      * @examples_end
      */
     void
-    write(LogLevel log_level, std::string value);
+    write(LogLevel log_level, std::string_view value);
+
+    /**
+     * @brief Write the record to the output (via callback) if its log level is enabled.
+     * @param record Record to be written. It is left in a valid, but unspecified state.
+     * @examples
+     * LogRecord record { Logger::LogLevel::info };
+     * record.append("Hello World!");
+     * Logger::get().write(std::move(record));
+     * @examples_end
+     */
+    void
+    write(LogRecord &&record);
+
+    /**
+     * @brief Enable the asynchronous logging mode.
+     *
+     * Once enabled, the `write` method only pushes the record into a bounded lock-free
+     * queue and the formatting + output (or the custom callback) is done by a background thread.
+     * If the asynchronous mode is already enabled, it is flushed and restarted with the new options.
+     *
+     * @param options Options for the asynchronous mode.
+     * @note Similarly to `setCustomCallback`, this method is meant to be used only during configuration.
+     * @examples
+     * Logger::get().enableAsync({ .m_capacity = 4096, .m_overflow_policy = Logger::OverflowPolicy::CountAndDrop });
+     * @examples_end
+     */
+    void
+    enableAsync(const AsyncOptions &options);
+
+    /**
+     * @brief Disable the asynchronous logging mode.
+     *
+     * All of the already queued records are written out before this method returns.
+     * Does nothing if the asynchronous mode is not enabled.
+     *
+     * @examples
+     * Logger::get().disableAsync();
+     * @examples_end
+     */
+    void
+    disableAsync();
+
+    /**
+     * @brief Check if the asynchronous logging mode is enabled.
+     * @returns True if enabled, false otherwise.
+     */
+    [[nodiscard]] bool
+    isAsyncEnabled() const;
+
+    /**
+     * @brief Wait until all the records queued before this call are written out.
+     * @note Does nothing if the asynchronous mode is not enabled.
+     * @examples
+     * DD_LOG(error) << "About to crash!";
+     * Logger::get().flush();
+     * @examples_end
+     */
+    void
+    flush();
+
+    /**
+     * @brief Enable the flight recorder.
+     *
+     * The flight recorder keeps the most recent records that were NOT written out due to
+     * the log level (e.g. verbose records while the info level is enabled) in a fixed-size lock-free ring.
+     * The records can then be dumped on demand, or automatically once an error happens.
+     * If the flight recorder is already enabled, it is restarted with the new options (the records are discarded).
+     *
+     * @param options Options for the flight recorder.
+     * @note Similarly to `enableAsync`, this method is meant to be used only during configuration.
+     * @warning Capturing is NOT free. Every statement at or above the capture level has its arguments
+     *          evaluated and appended to a record, exactly as if it was written out (only the text
+     *          formatting and the sink are skipped). This includes expensive arguments such as the
+     *          `toJson` dumps, which are fully built even though only the first `m_record_size` bytes
+     *          are kept. Keep the capture level as high as the diagnostics allow (see `BM_Log_FlightRecorder`
+     *          for the cost per statement).
+     * @examples
+     * Logger::get().setLogLevel(Logger::LogLevel::info);
+     * Logger::get().enableFlightRecorder({ .m_capacity = 512, .m_capture_level = Logger::LogLevel::debug });
+     * @examples_end
+     */
+    void
+    enableFlightRecorder(const FlightRecorderOptions &options);
+
+    /**
+     * @brief Disable the flight recorder and discard the recorded records.
+     * @note Does nothing if the flight recorder is not enabled.
+     */
+    void
+    disableFlightRecorder();
+
+    /**
+     * @brief Check if the flight recorder is enabled.
+     * @returns True if enabled, false otherwise.
+     */
+    [[nodiscard]] bool
+    isFlightRecorderEnabled() const;
+
+    /**
+     * @brief Write out the recorded records that have not been dumped yet (regardless of the log level).
+     * @note Does nothing if the flight recorder is not enabled.
+     * @examples
+     * if (result != SettingsManagerInterface::ApplyResult::Ok) {
+     *   Logger::get().dumpFlightRecorder();
+     * }
+     * @examples_end
+     */
+    void
+    dumpFlightRecorder();
 
     /**
      * @brief A deleted copy constructor for singleton pattern.
@@ -107,25 +363,395 @@ namespace display_device {
     operator=(Logger const &) = delete;
 
   private:
+    class AsyncSink;
+    class FlightRecorder;
+
     /**
      * @brief A private constructor to ensure the singleton pattern.
      */
     explicit Logger();
 
-    LogLevel m_enabled_log_level; /**< The currently enabled log level. */
+    /**
+     * @brief A private destructor that flushes and stops the asynchronous mode.
+     */
+    ~Logger();
+
+    /**
+     * @brief Write the record to the custom callback or the default output (without checking the log level).
+     * @param record Record to be written.
+     */
+    void
+    writeToSink(const LogRecord &record);
+
+    /**
+     * @brief Pass the record to the asynchronous sink (if enabled) or write it out directly (without checking the log level).
+     * @param record Record to be written. It is left in a valid, but unspecified state.
+     */
+    void
+    dispatch(LogRecord &record);
+
+    /**
+     * @brief Recalculate the capture levels after the log levels or the flight recorder have changed.
+     */
+    void
+    updateCaptureLevels();
+
+    /**
+     * @brief Enabled log level of a single channel.
+     */
+    struct ChannelLogLevel {
+      std::atomic<LogLevel> m_log_level { LogLevel::info };  ///< The currently enabled log level.
+      std::atomic<LogLevel> m_capture_level { LogLevel::info };  ///< The lowest level that needs to be captured (for the output or the flight recorder).
+    };
+
+    static constexpr std::size_t m_channel_count { static_cast<std::size_t>(LogChannel::scheduler) + 1 }; /**< Number of available channels. */
+    static std::array<ChannelLogLevel, m_channel_count> m_channel_log_levels; /**< The currently enabled log levels (indexed by the channel). */
     Callback m_custom_callback; /**< Custom callback to pass log data to. */
+    RecordCallback m_custom_record_callback; /**< Custom callback to pass structured log data to. */
+    std::unique_ptr<AsyncSink> m_async_sink; /**< Background sink used in the asynchronous mode. */
+    std::unique_ptr<FlightRecorder> m_flight_recorder; /**< Recorder of the records that were not written out. */
+  };
+
+  // Defined outside of the class, because the ChannelLogLevel is incomplete until then.
+  inline std::array<Logger::ChannelLogLevel, Logger::m_channel_count> Logger::m_channel_log_levels {};
+
+  namespace detail {
+    /**
+     * @brief Check if the value can be written to the output stream.
+     */
+    template <class T>
+    concept OStreamable = requires(std::ostream &stream, const T &value) { stream << value; };
+
+    /**
+     * @brief Check if the value is one of the parameterized manipulators from the `<iomanip>` header.
+     */
+    template <class T>
+    concept IomanipManipulator = std::is_same_v<T, decltype(std::setw(0))> || std::is_same_v<T, decltype(std::setprecision(0))> ||
+                                 std::is_same_v<T, decltype(std::setfill('0'))> || std::is_same_v<T, decltype(std::setbase(0))> ||
+                                 std::is_same_v<T, decltype(std::setiosflags(std::ios_base::fmtflags {}))> ||
+                                 std::is_same_v<T, decltype(std::resetiosflags(std::ios_base::fmtflags {}))>;
+
+    /**
+     * @brief Check if the value is a pointer to the (possibly signed or unsigned) characters, which the `std::ostream` writes as a string.
+     */
+    template <class T>
+    concept CharacterPointer = std::is_pointer_v<T> && (std::is_same_v<std::remove_const_t<std::remove_pointer_t<T>>, char> ||
+                                                        std::is_same_v<std::remove_const_t<std::remove_pointer_t<T>>, signed char> ||
+                                                        std::is_same_v<std::remove_const_t<std::remove_pointer_t<T>>, unsigned char>);
+
+    /**
+     * @brief Append the "[YYYY-MM-DD HH:MM:SS.mmm] " prefix used by the default log output.
+     * @param output String to append the prefix to.
+     * @param timestamp Time to be formatted.
+     * @note The "[YYYY-MM-DD HH:MM:SS." part is cached per thread and is only
+     *       re-formatted when the second changes.
+     */
+    void
+    appendLogTimestamp(std::string &output, std::chrono::system_clock::time_point timestamp);
+
+    /**
+     * @brief Append the record as a single line in the format used by the default log output
+     *        ("[YYYY-MM-DD HH:MM:SS.mmm] LEVEL:   text", without the line break).
+     * @param output String to append the line to.
+     * @param record Record to be formatted.
+     */
+    void
+    appendLogLine(std::string &output, const LogRecord &record);
+  }  // namespace detail
+
+  /**
+   * @brief A compact binary representation of a single log statement.
+   *
+   * The streamed values are captured as they are (integers, floating point values, strings, etc.)
+   * and the text formatting is deferred until the record is written out by the sink.
+   * Types that are not natively supported are formatted via `std::ostream` immediately and
+   * are captured as strings.
+   *
+   * @note Stream manipulators of the `std::ios_base &(std::ios_base &)` type (e.g. `std::hex`, `std::boolalpha`)
+   *       are supported. The parameterized manipulators (e.g. `std::setw`) are rejected at compile time.
+   */
+  class LogRecord {
+  public:
+    /**
+     * @brief A stream manipulator captured in the record.
+     */
+    struct Manipulator {
+      std::ios_base &(*m_function)(std::ios_base &);  ///< The manipulator function (e.g. `std::hex`).
+    };
+
+    /**
+     * @brief Default constructor.
+     * @param log_level Log level of the record.
+     * @param channel Channel of the record.
+     */
+    explicit LogRecord(Logger::LogLevel log_level = Logger::LogLevel::verbose, Logger::LogChannel channel = Logger::LogChannel::general);
+
+    /**
+     * @brief Get the log level of the record.
+     * @returns The log level.
+     */
+    [[nodiscard]] Logger::LogLevel
+    getLogLevel() const;
+
+    /**
+     * @brief Get the channel of the record.
+     * @returns The channel.
+     */
+    [[nodiscard]] Logger::LogChannel
+    getChannel() const;
+
+    /**
+     * @brief Get the time when the record was written.
+     * @returns The timestamp.
+     */
+    [[nodiscard]] std::chrono::system_clock::time_point
+    getTimestamp() const;
+
+    /**
+     * @brief Check if the record contains any values.
+     * @returns True if record is empty, false otherwise.
+     */
+    [[nodiscard]] bool
+    empty() const;
+
+    /**
+     * @brief Remove all the values and set the new log level (the allocated memory is kept).
+     * @param log_level New log level of the record.
+     * @param channel New channel of the record.
+     */
+    void
+    reset(Logger::LogLevel log_level, Logger::LogChannel channel = Logger::LogChannel::general);
+
+    /**
+     * @brief Capture the value in the record.
+     * @param value Value to be captured.
+     * @examples
+     * LogRecord record;
+     * record.append("Hello World! ");
+     * record.append(123);
+     * @examples_end
+     */
+    template <class T>
+    void
+    append(T &&value) {
+      using U = std::remove_cvref_t<T>;
+      if constexpr (std::is_same_v<U, bool>) {
+        appendValue(ArgumentType::Bool, value);
+      }
+      else if constexpr (std::is_same_v<U, char> || std::is_same_v<U, signed char> || std::is_same_v<U, unsigned char>) {
+        appendValue(ArgumentType::Char, static_cast<char>(value));
+      }
+      else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+        appendValue(getSignedIntegerType<U>(), static_cast<std::int64_t>(value));
+      }
+      else if constexpr (std::is_integral_v<U>) {
+        appendValue(ArgumentType::UnsignedInteger, static_cast<std::uint64_t>(value));
+      }
+      else if constexpr (std::is_floating_point_v<U>) {
+        appendValue(ArgumentType::FloatingPoint, static_cast<double>(value));
+      }
+      else if constexpr (detail::CharacterPointer<U>) {
+        // Same as the std::ostream, the signed/unsigned char pointers are written as strings too
+        appendString(value ? std::string_view { reinterpret_cast<const char *>(value) } : std::string_view {});
+      }
+      else if constexpr (std::is_convertible_v<const U &, std::string_view>) {
+        appendString(std::string_view { value });
+      }
+      else if constexpr (std::is_same_v<U, std::ios_base &(std::ios_base &)> || std::is_same_v<U, std::ios_base &(*)(std::ios_base &)>) {
+        appendManipulator(Manipulator { value });
+      }
+      else if constexpr (std::is_enum_v<U> && !detail::OStreamable<U>) {
+        append(static_cast<std::underlying_type_t<U>>(value));
+      }
+      else if constexpr (std::is_null_pointer_v<U>) {
+        appendString("nullptr");
+      }
+      else if constexpr (std::is_pointer_v<U> && !std::is_function_v<std::remove_pointer_t<U>>) {
+        appendValue(ArgumentType::Pointer, static_cast<const void *>(value));
+      }
+      else {
+        static_assert(!detail::IomanipManipulator<U>, "Parameterized stream manipulators (e.g. std::setw) are not supported in the log!");
+        static_assert(detail::OStreamable<U>, "Value type cannot be written to the log!");
+        auto &stream { getFallbackStream(m_flags) };
+        stream << value;
+        appendString(stream.view());
+      }
+    }
+
+    /**
+     * @brief Visit all the captured values in order.
+     * @param visitor A callable that accepts any of the following types:
+     *                `bool`, `char`, `std::int64_t`, `std::uint64_t`, `double`,
+     *                `std::string_view`, `const void *` and `LogRecord::Manipulator`.
+     * @examples
+     * record.visit([](const auto &value) {
+     *   // serialize the value to some binary format or something
+     * });
+     * @examples_end
+     */
+    template <class Visitor>
+    void
+    visit(Visitor &&visitor) const {
+      visitTyped([&visitor](ArgumentType, const auto &value) { visitor(value); });
+    }
+
+    /**
+     * @brief Format the captured values as text (same as `std::ostream` would).
+     * @param output String to append the formatted text to.
+     */
+    void
+    format(std::string &output) const;
+
+    /**
+     * @brief Format the captured values as text.
+     * @returns The formatted text.
+     */
+    [[nodiscard]] std::string
+    toString() const;
+
+  private:
+    friend class Logger;
+
+    /**
+     * @brief Type tags of the captured values in the binary buffer.
+     */
+    enum class ArgumentType : std::uint8_t {
+      Bool,
+      Char,
+      SignedInteger,
+      SignedInteger32,  ///< Captured as `std::int64_t`, but was originally 32 bits wide.
+      SignedInteger16,  ///< Captured as `std::int64_t`, but was originally 16 bits wide.
+      UnsignedInteger,
+      FloatingPoint,
+      String,
+      Pointer,
+      Manipulator
+    };
+
+    /**
+     * @brief Visit all the captured values in order, together with their type tags.
+     * @param visitor A callable that accepts the type tag and any of the types listed in `visit`.
+     */
+    template <class Visitor>
+    void
+    visitTyped(Visitor &&visitor) const {
+      std::size_t pos { 0 };
+      while (pos < m_data.size()) {
+        const auto type { static_cast<ArgumentType>(m_data[pos++]) };
+        switch (type) {
+          case ArgumentType::Bool:
+            visitor(type, readValue<bool>(pos));
+            break;
+          case ArgumentType::Char:
+            visitor(type, readValue<char>(pos));
+            break;
+          case ArgumentType::SignedInteger:
+          case ArgumentType::SignedInteger32:
+          case ArgumentType::SignedInteger16:
+            visitor(type, readValue<std::int64_t>(pos));
+            break;
+          case ArgumentType::UnsignedInteger:
+            visitor(type, readValue<std::uint64_t>(pos));
+            break;
+          case ArgumentType::FloatingPoint:
+            visitor(type, readValue<double>(pos));
+            break;
+          case ArgumentType::String: {
+            const auto size { readValue<std::uint32_t>(pos) };
+            visitor(type, std::string_view { m_data.data() + pos, size });
+            pos += size;
+            break;
+          }
+          case ArgumentType::Pointer:
+            visitor(type, readValue<const void *>(pos));
+            break;
+          case ArgumentType::Manipulator:
+            visitor(type, readValue<Manipulator>(pos));
+            break;
+        }
+      }
+    }
+
+    /**
+     * @brief Get the type tag of the signed integer.
+     * @returns The type tag that keeps the original size, so that the negative values
+     *          are formatted the same as by the `std::ostream` in hex/oct.
+     */
+    template <class U>
+    static constexpr ArgumentType
+    getSignedIntegerType() {
+      if constexpr (sizeof(U) <= sizeof(std::int16_t)) {
+        return ArgumentType::SignedInteger16;
+      }
+      else if constexpr (sizeof(U) <= sizeof(std::int32_t)) {
+        return ArgumentType::SignedInteger32;
+      }
+      else {
+        return ArgumentType::SignedInteger;
+      }
+    }
+
+    template <class U>
+    void
+    appendValue(const ArgumentType type, const U &value) {
+      const auto pos { m_data.size() };
+      m_data.resize(pos + 1 + sizeof(U));
+      m_data[pos] = static_cast<char>(type);
+      std::memcpy(m_data.data() + pos + 1, &value, sizeof(U));
+    }
+
+    template <class U>
+    U
+    readValue(std::size_t &pos) const {
+      U value;
+      std::memcpy(&value, m_data.data() + pos, sizeof(U));
+      pos += sizeof(U);
+      return value;
+    }
+
+    /**
+     * @brief Capture the string in the record.
+     * @param value String to be captured.
+     */
+    void
+    appendString(std::string_view value);
+
+    /**
+     * @brief Capture the manipulator in the record and apply it to the tracked stream flags.
+     * @param manipulator Manipulator to be captured.
+     */
+    void
+    appendManipulator(Manipulator manipulator);
+
+    /**
+     * @brief Get the cleared thread-local stream for formatting the values that are not natively supported.
+     * @param flags Stream flags to be set (so that the values are formatted with the manipulators captured so far).
+     * @returns Reference to the stream.
+     */
+    static std::ostringstream &
+    getFallbackStream(std::ios_base::fmtflags flags);
+
+    Logger::LogLevel m_log_level; /**< Log level of the record. */
+    Logger::LogChannel m_channel; /**< Channel of the record. */
+    std::chrono::system_clock::time_point m_timestamp {}; /**< Time when the record was written. */
+    std::vector<char> m_data; /**< Type-tagged values in the binary form. */
+    std::ios_base::fmtflags m_flags { std::ios_base::dec | std::ios_base::skipws }; /**< Stream flags after the captured manipulators (for the fallback stream). */
   };
 
   /**
    * @brief A helper class for accumulating output via the stream operator and then writing it out at once.
+   * @note A thread-local record is reused by the writers of the same thread, so that no allocations
+   *       are needed once the record has grown large enough. Nested writers (e.g. logging from within
+   *       the stream operator of some value) use their own record.
    */
   class LogWriter {
   public:
     /**
      * @brief Constructor scoped writer utility.
      * @param log_level Level to be used when writing out the output.
+     * @param channel Channel to be used when writing out the output.
      */
-    explicit LogWriter(Logger::LogLevel log_level);
+    explicit LogWriter(Logger::LogLevel log_level, Logger::LogChannel channel = Logger::LogChannel::general);
 
     /**
      * @brief Write out the accumulated output.
@@ -138,25 +764,117 @@ namespace display_device {
      * @returns Reference to the writer utility for chaining the operators.
      */
     template <class T>
+      requires(!std::is_same_v<std::remove_cvref_t<T>, LogDedupPayload>)
     LogWriter &
     operator<<(T &&value) {
-      m_buffer << std::forward<T>(value);
+      m_record->append(std::forward<T>(value));
       return *this;
     }
 
+    /**
+     * @brief Stream the deduplicated payload to the buffer.
+     * @param value Payload to be written to the buffer (or replaced with the marker).
+     * @returns Reference to the writer utility for chaining the operators.
+     */
+    LogWriter &
+    operator<<(const LogDedupPayload &value);
+
+  private:
+    LogRecord *m_record; /**< Record to hold all the output (thread-local or the nested one). */
+    std::optional<LogRecord> m_nested_record; /**< Record used when the thread-local one is already in use. */
+  };
+
+  /**
+   * @brief Per call site state used for the deduplication of repeated log payloads.
+   * @see DD_LOG_DEDUP
+   */
+  class LogDedupState {
+  public:
+    /**
+     * @brief Remember the hash of the payload being logged.
+     * @param hash Hash of the payload.
+     * @returns True if the hash matches the previously logged one, false otherwise.
+     */
+    [[nodiscard]] bool
+    exchange(std::uint64_t hash);
+
+  private:
+    std::atomic<std::uint64_t> m_last_hash { 0 }; /**< Hash of the last logged payload (0 if nothing was logged yet). */
+  };
+
+  /**
+   * @brief A log value that is replaced with a short marker if the payload
+   *        has not changed since the last time it was logged from the same call site.
+   * @note Only the records that are written out take part in the deduplication. The records that are
+   *       only captured for the flight recorder keep the full payload and do not update the state.
+   * @see DD_LOG_DEDUP
+   */
+  class LogDedupPayload {
+  public:
+    /**
+     * @brief Constructor for the payload logged from the call site.
+     * @param state State of the call site.
+     * @param payload Payload to be logged.
+     * @warning The payload must outlive this object, which is the case for the whole log statement.
+     */
+    LogDedupPayload(LogDedupState &state, std::string_view payload);
+
+    /**
+     * @brief Capture the payload in the record, or the "unchanged (hash=...)" marker if the payload
+     *        is the same as the one previously written out from the call site.
+     * @param record Record to capture the payload in.
+     */
+    void
+    appendTo(LogRecord &record) const;
+
   private:
-    Logger::LogLevel m_log_level; /**< Log level to be used. */
-    std::ostringstream m_buffer; /**< Buffer to hold all the output. */
+    LogDedupState *m_state; /**< State of the call site. */
+    std::string_view m_payload; /**< The original payload. */
   };
+
+  namespace detail {
+    /**
+     * @brief Compute the FNV-1a hash of the log payload.
+     * @param payload Payload to hash.
+     * @returns The hash value.
+     */
+    [[nodiscard]] std::uint64_t
+    hashLogPayload(std::string_view payload);
+  }  // namespace detail
 }  // namespace display_device
 
 /**
- * @brief Helper MACRO that disables output string computation if log level is not enabled.
+ * @brief Helper MACRO that disables output string computation if log level is not enabled for the channel.
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are discarded at compile time.
+ * @note Statements are also captured if they are needed by the flight recorder.
+ * @examples
+ * DD_LOG_CH(winapi, verbose) << "Hello World!" << " " << 123;
+ * DD_LOG_CH(settings, error) << "OH MY GAWD!";
+ * @examples_end
+ */
+#define DD_LOG_CH(channel, level)                                                                                                                                                              \
+  if constexpr (!display_device::Logger::isLogLevelCompiledIn(display_device::Logger::LogLevel::level)) {}                                                                                     \
+  else                                                                                                                                                                                         \
+    for (bool is_enabled { display_device::Logger::isLogLevelCaptured(display_device::Logger::LogChannel::channel, display_device::Logger::LogLevel::level) }; is_enabled; is_enabled = false) \
+    display_device::LogWriter(display_device::Logger::LogLevel::level, display_device::Logger::LogChannel::channel)
+
+/**
+ * @brief Helper MACRO that disables output string computation if log level is not enabled (for the general channel).
+ * @note Statements below the `DD_LOG_MIN_LEVEL` are discarded at compile time.
  * @examples
  * DD_LOG(info) << "Hello World!" << " " << 123;
  * DD_LOG(error) << "OH MY GAWD!";
  * @examples_end
  */
-#define DD_LOG(level)                                                                                                                                \
-  for (bool is_enabled { display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogLevel::level) }; is_enabled; is_enabled = false) \
-  display_device::LogWriter(display_device::Logger::LogLevel::level)
+#define DD_LOG(level) DD_LOG_CH(general, level)
+
+/**
+ * @brief Helper MACRO that logs the payload only if it differs from the one previously logged from the same call site.
+ *        Otherwise only a short "unchanged (hash=...)" marker is logged.
+ * @note The payload is only evaluated if the log level is captured, the same as any other streamed value.
+ * @examples
+ * DD_LOG(info) << "Currently available devices:\n" << DD_LOG_DEDUP(toJson(devices));
+ * @examples_end
+ */
+#define DD_LOG_DEDUP(payload) \
+  display_device::LogDedupPayload { []() -> display_device::LogDedupState & { static display_device::LogDedupState state; return state; }(), payload }
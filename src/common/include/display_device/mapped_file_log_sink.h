@@ -0,0 +1,156 @@
+/**
+ * @file src/common/include/display_device/mapped_file_log_sink.h
+ * @brief Declarations for the memory-mapped file log sink.
+ */
+#pragma once
+
+// system includes
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// local includes
+#include "logging.h"
+
+namespace display_device {
+  /**
+   * @brief A log sink that writes the records into preallocated memory-mapped file segments.
+   *
+   * Writing a record only formats it and copies it into the mapped memory at an atomically
+   * reserved offset, so the producer threads never call `write()` or wait for each other.
+   * Once the segment is full, the writers switch to the next segment that has already been created
+   * by a background thread. The full segment is closed and the oldest segments above the limit are
+   * removed by the background thread as well, which then creates the segment after the next one.
+   *
+   * The data is written to the OS page cache immediately, so the already written records
+   * survive a process crash or abort. In such case the rest of the segment is filled with zeros.
+   * On a normal shutdown the segment is truncated to its actual size.
+   *
+   * Segments are named as `<stem>.<number><extension>` (e.g. `display_device.3.log` for the `display_device.log` filepath).
+   * The numbering continues from the segments of the previous runs.
+   *
+   * @examples
+   * MappedFileLogSink sink { { .m_filepath = "logs/display_device.log" } };
+   * Logger::get().setCustomRecordCallback([&sink](const LogRecord &record) { sink.write(record); });
+   * @examples_end
+   */
+  class MappedFileLogSink {
+  public:
+    /**
+     * @brief Options for the sink.
+     */
+    struct Options {
+      std::filesystem::path m_filepath;  ///< Base path of the segment files (the directory must exist).
+      std::size_t m_segment_size { 4 * 1024 * 1024 };  ///< Size of a single segment in bytes.
+      std::size_t m_max_segments { 4 };  ///< Maximum number of segments to keep on the disk.
+    };
+
+    /**
+     * @brief Default constructor that creates the first segment.
+     * @param options Options for the sink. Throws on empty filepath, zero sizes or failure to create the segment.
+     */
+    explicit MappedFileLogSink(Options options);
+
+    /**
+     * @brief Close the current segment and truncate it to its actual size (the unused pre-created segment is removed).
+     */
+    ~MappedFileLogSink();
+
+    /**
+     * @brief A deleted copy constructor.
+     */
+    MappedFileLogSink(const MappedFileLogSink &) = delete;
+
+    /**
+     * @brief A deleted assignment operator.
+     */
+    MappedFileLogSink &
+    operator=(const MappedFileLogSink &) = delete;
+
+    /**
+     * @brief Format the record (the same as the default log output) and append it to the file.
+     * @param record Record to be written.
+     */
+    void
+    write(const LogRecord &record);
+
+    /**
+     * @brief Append the already formatted data to the file.
+     * @param data Data to be written. Data larger than the segment is truncated.
+     */
+    void
+    write(std::string_view data);
+
+    /**
+     * @brief Get the path of the segment that is currently being written to.
+     * @returns The segment path.
+     */
+    [[nodiscard]] std::filesystem::path
+    getCurrentSegmentPath() const;
+
+    /**
+     * @brief Get the number of writes that were dropped, because a new segment could not be created.
+     * @returns The number of dropped writes.
+     */
+    [[nodiscard]] std::uint64_t
+    getDroppedCount() const;
+
+  private:
+    class MappedFile;
+
+    /**
+     * @brief Get the path of the segment.
+     * @param number Number of the segment.
+     * @returns The segment path.
+     */
+    [[nodiscard]] std::filesystem::path
+    getSegmentPath(std::uint64_t number) const;
+
+    /**
+     * @brief Switch to the next segment (if no other writer has done it already).
+     * @param full_segment_number Number of the segment that was found full.
+     */
+    void
+    rotate(std::uint64_t full_segment_number);
+
+    /**
+     * @brief Swap in the pre-created next segment and pass the current one to the background thread (the exclusive lock must be held).
+     * @note Only waits if the background thread has not finished creating the next segment yet.
+     * @note On failure, the current segment is left empty and the writes are dropped.
+     */
+    void
+    openNextSegmentUnlocked();
+
+    /**
+     * @brief Main loop of the background thread that closes the full segments, removes the expired ones and creates the next one.
+     */
+    void
+    runBackground();
+
+    Options m_options;
+    std::unique_ptr<MappedFile> m_file; /**< Currently mapped segment (nullptr if the creation has failed). */
+    std::uint64_t m_segment_number { 0 }; /**< Number of the current segment. */
+    mutable std::shared_mutex m_mutex; /**< Writers hold a shared lock only to keep the segment mapped, the rotation holds an exclusive one. */
+    std::atomic<std::size_t> m_offset { 0 }; /**< Next free offset in the current segment. */
+    std::atomic<std::uint64_t> m_dropped { 0 };
+
+    std::mutex m_background_mutex; /**< Guards the members shared with the background thread. */
+    std::condition_variable m_background_cv; /**< Notified when there is work for the background thread or the next segment is ready. */
+    std::unique_ptr<MappedFile> m_next_file; /**< Pre-created next segment (nullptr if the creation has failed). */
+    std::uint64_t m_next_segment_number { 0 }; /**< Number of the next segment. */
+    bool m_next_file_ready { false }; /**< Set once the background thread has attempted to create the next segment. */
+    std::vector<std::unique_ptr<MappedFile>> m_full_files; /**< Full segments to be closed by the background thread. */
+    std::vector<std::uint64_t> m_expired_segments; /**< Segments to be removed by the background thread. */
+    bool m_stop { false };
+
+    // Always the last in the list so that all the members are already initialized!
+    std::thread m_background_thread;
+  };
+}  // namespace display_device
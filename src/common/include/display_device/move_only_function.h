@@ -0,0 +1,226 @@
+/**
+ * @file src/common/include/display_device/move_only_function.h
+ * @brief Declarations for the small-buffer move-only function wrapper.
+ */
+#pragma once
+
+// system includes
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace display_device {
+  template <class Signature, std::size_t Capacity = 6 * sizeof(void *)>
+  class MoveOnlyFunction;
+
+  /**
+   * @brief A move-only function wrapper that stores small callables inline instead of allocating them.
+   *
+   * Similar to the `std::move_only_function`, except that the inline capacity is known (and configurable),
+   * so that the callables capturing a couple of references or pointers never allocate. Callables that do not
+   * fit (or can throw while moving) are stored on the heap instead.
+   *
+   * @tparam R Return type of the function.
+   * @tparam Args Argument types of the function.
+   * @tparam Capacity Size of the inline storage in bytes.
+   * @examples
+   * int counter { 0 };
+   * MoveOnlyFunction<void()> increment { [&counter]() { counter++; } };
+   * increment();
+   * @examples_end
+   */
+  template <class R, class... Args, std::size_t Capacity>
+  class MoveOnlyFunction<R(Args...), Capacity> final {
+    /**
+     * @brief Type-erased operations of the stored callable.
+     */
+    struct Operations {
+      R (*m_invoke)(void *storage, Args &&...args); /**< Invoke the callable. */
+      void (*m_move)(void *from, void *to) noexcept; /**< Move the callable to the uninitialized storage and destroy the source. */
+      void (*m_destroy)(void *storage) noexcept; /**< Destroy the callable. */
+      bool m_inline; /**< Specifies whether the callable is stored in the inline storage. */
+    };
+
+    template <class FunctionT>
+    static constexpr bool m_fits_inline { sizeof(FunctionT) <= Capacity && alignof(std::max_align_t) % alignof(FunctionT) == 0 && std::is_nothrow_move_constructible_v<FunctionT> };
+
+    template <class FunctionT>
+    static constexpr Operations m_inline_operations {
+      [](void *storage, Args &&...args) -> R {
+        if constexpr (std::is_void_v<R>) {
+          std::invoke(*static_cast<FunctionT *>(storage), std::forward<Args>(args)...);
+        }
+        else {
+          return std::invoke(*static_cast<FunctionT *>(storage), std::forward<Args>(args)...);
+        }
+      },
+      [](void *from, void *to) noexcept {
+        auto *function { static_cast<FunctionT *>(from) };
+        ::new (to) FunctionT(std::move(*function));
+        function->~FunctionT();
+      },
+      [](void *storage) noexcept {
+        static_cast<FunctionT *>(storage)->~FunctionT();
+      },
+      true
+    };
+
+    template <class FunctionT>
+    static constexpr Operations m_heap_operations {
+      [](void *storage, Args &&...args) -> R {
+        if constexpr (std::is_void_v<R>) {
+          std::invoke(**static_cast<FunctionT **>(storage), std::forward<Args>(args)...);
+        }
+        else {
+          return std::invoke(**static_cast<FunctionT **>(storage), std::forward<Args>(args)...);
+        }
+      },
+      [](void *from, void *to) noexcept {
+        ::new (to) FunctionT *(*static_cast<FunctionT **>(from));
+      },
+      [](void *storage) noexcept {
+        delete *static_cast<FunctionT **>(storage);
+      },
+      false
+    };
+
+  public:
+    static_assert(Capacity >= sizeof(void *), "MoveOnlyFunction capacity must fit at least a pointer!");
+
+    /**
+     * @brief Default constructor for an empty function.
+     */
+    MoveOnlyFunction() noexcept = default;
+
+    /**
+     * @brief Constructor for an empty function.
+     */
+    MoveOnlyFunction(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Constructor that stores the callable.
+     * @param function Callable to be stored. If it is an empty function (like a nullptr function pointer
+     *                 or an empty `std::function`), the wrapper is empty as well.
+     */
+    template <class FunctionT, class DecayedT = std::decay_t<FunctionT>>
+      requires(!std::is_same_v<DecayedT, MoveOnlyFunction> && std::is_invocable_r_v<R, DecayedT &, Args...>)
+    MoveOnlyFunction(FunctionT &&function) {
+      if constexpr (std::is_pointer_v<DecayedT> || std::is_member_pointer_v<DecayedT> || requires { function.target_type(); }) {
+        if (!function) {
+          return;
+        }
+      }
+
+      if constexpr (m_fits_inline<DecayedT>) {
+        ::new (static_cast<void *>(m_storage)) DecayedT(std::forward<FunctionT>(function));
+        m_operations = &m_inline_operations<DecayedT>;
+      }
+      else {
+        ::new (static_cast<void *>(m_storage)) DecayedT *(new DecayedT(std::forward<FunctionT>(function)));
+        m_operations = &m_heap_operations<DecayedT>;
+      }
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other Function to move from. It is left empty.
+     */
+    MoveOnlyFunction(MoveOnlyFunction &&other) noexcept {
+      moveFrom(other);
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other Function to move from. It is left empty.
+     * @returns Reference to this function.
+     */
+    MoveOnlyFunction &
+    operator=(MoveOnlyFunction &&other) noexcept {
+      if (this != &other) {
+        reset();
+        moveFrom(other);
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    MoveOnlyFunction(const MoveOnlyFunction &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    MoveOnlyFunction &
+    operator=(const MoveOnlyFunction &) = delete;
+
+    /**
+     * @brief Destroys the stored callable.
+     */
+    ~MoveOnlyFunction() {
+      reset();
+    }
+
+    /**
+     * @brief Invoke the stored callable.
+     * @param args Arguments for the callable.
+     * @returns The result of the callable.
+     * @throws std::bad_function_call if the function is empty.
+     */
+    R
+    operator()(Args... args) {
+      if (!m_operations) {
+        throw std::bad_function_call {};
+      }
+      return m_operations->m_invoke(static_cast<void *>(m_storage), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Check if the function is not empty.
+     * @returns True if the callable is stored, false otherwise.
+     */
+    explicit
+    operator bool() const noexcept {
+      return m_operations != nullptr;
+    }
+
+    /**
+     * @brief Check if the callable is stored in the inline storage (was not allocated).
+     * @returns True if the callable is stored inline or the function is empty, false otherwise.
+     */
+    [[nodiscard]] bool
+    isInline() const noexcept {
+      return !m_operations || m_operations->m_inline;
+    }
+
+  private:
+    /**
+     * @brief Destroy the stored callable (if any).
+     */
+    void
+    reset() noexcept {
+      if (m_operations) {
+        m_operations->m_destroy(static_cast<void *>(m_storage));
+        m_operations = nullptr;
+      }
+    }
+
+    /**
+     * @brief Take over the callable from the other function, leaving it empty.
+     * @param other Function to move from.
+     */
+    void
+    moveFrom(MoveOnlyFunction &other) noexcept {
+      if (other.m_operations) {
+        other.m_operations->m_move(static_cast<void *>(other.m_storage), static_cast<void *>(m_storage));
+        m_operations = std::exchange(other.m_operations, nullptr);
+      }
+    }
+
+    const Operations *m_operations { nullptr };
+    alignas(std::max_align_t) std::byte m_storage[Capacity];
+  };
+}  // namespace display_device
@@ -6,13 +6,35 @@
 
 // system includes
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <deque>
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
 
 // local includes
+#include "backoff_policy.h"
 #include "logging.h"
+#include "move_only_function.h"
+#include "scheduler_clock.h"
+#include "scheduler_event_source.h"
+#include "scheduler_executor.h"
+#include "scheduler_metrics.h"
 
 namespace display_device {
   /**
@@ -28,7 +50,7 @@ namespace display_device {
      * @brief Default constructor.
      * @param cleanup Function to be executed once the destructor is called (object goes out of scope).
      */
-    explicit SchedulerStopToken(std::function<void()> cleanup);
+    explicit SchedulerStopToken(MoveOnlyFunction<void()> cleanup);
 
     /**
      * @brief Deleted copy constructor.
@@ -61,7 +83,7 @@ namespace display_device {
 
   private:
     bool m_stop_requested { false };
-    std::function<void()> m_cleanup;
+    MoveOnlyFunction<void()> m_cleanup;
   };
 
   namespace detail {
@@ -96,6 +118,22 @@ namespace display_device {
     template <class T, bool AddConst>
     using auto_const_t = typename AutoConst<T, AddConst>::type;
 
+    /**
+     * @brief Type of the function result in the `executeBatch` tuple (`std::monostate` for the void results).
+     */
+    template <class ResultT>
+    using batch_result_t = std::conditional_t<std::is_void_v<ResultT>, std::monostate, ResultT>;
+
+    /**
+     * @brief Check if the mutex can be locked in a shared mode with a timeout (e.g. `std::shared_timed_mutex`).
+     */
+    template <class MutexT>
+    concept SharedTimedLockable = requires(MutexT &mutex, std::chrono::milliseconds timeout) {
+      mutex.lock_shared();
+      { mutex.try_lock_shared_for(timeout) } -> std::convertible_to<bool>;
+      mutex.unlock_shared();
+    };
+
     /**
      * @brief Check if the function signature matches the acceptable signature for RetryScheduler::execute
      *        without a stop token.
@@ -132,69 +170,310 @@ namespace display_device {
       ScheduledOnly  ///< Executor is executed in the thread only.
     };
 
+    /**
+     * @brief Defines from which time point the next sleep duration is measured.
+     */
+    enum class Cadence {
+      FixedDelay,  ///< Sleep duration is measured from the end of the previous execution (the execution time adds up).
+      FixedRate  ///< Sleep duration is measured from the previous deadline, so the execution time does not shift the schedule.
+    };
+
+    /**
+     * @brief Defines what happens with the `FixedRate` deadlines that were missed because the execution took too long.
+     */
+    enum class CatchUp {
+      Skip,  ///< Missed deadlines are dropped and the executor is executed at the next deadline in the future.
+      Burst  ///< Executor is executed right away for every missed deadline until it catches up.
+    };
+
     std::vector<std::chrono::milliseconds> m_sleep_durations;  ///< Specifies for long the scheduled thread sleeps before invoking executor. Last duration is reused indefinitely.
     Execution m_execution { Execution::Immediate };  ///< Executor's execution logic.
+    std::optional<BackoffPolicy> m_backoff_policy;  ///< Policy for calculating the sleep durations without allocations. If set, `m_sleep_durations` are ignored.
+    Cadence m_cadence { Cadence::FixedDelay };  ///< Specifies from which time point the sleep durations are measured.
+    CatchUp m_catch_up { CatchUp::Skip };  ///< Catch-up logic for the missed deadlines (used with `Cadence::FixedRate` only).
+    std::optional<std::uint64_t> m_max_attempts;  ///< Maximum number of the executions (including the immediate one) before giving up.
+    std::optional<std::chrono::milliseconds> m_timeout;  ///< Time (since scheduling) after which no more executions are started.
+    std::function<void()> m_on_exhausted;  ///< Executed on the scheduler thread (without holding the interface mutex) once the attempts or the time run out.
+    std::chrono::milliseconds m_coalesce_window { 0 };  ///< If larger than 0, the calls with the same `m_coalesce_key` within this window (since the first call) are merged into the first one.
+    std::string m_coalesce_key;  ///< Key identifying the equivalent jobs for the coalescing.
   };
 
   /**
    * @brief A wrapper class around an interface that provides a thread-safe access to the
    *        interface and allows to schedule arbitrary logic for it to retry until it succeeds.
-   * @note The scheduler is designed to only schedule 1 callback at a time, until it is either
-   *       replaced or stopped.
+   * @note The `schedule` method manages a single callback that is replaced on every call, while the
+   *       `scheduleJob` method allows to schedule additional independent jobs with their own cadence.
+   *       All the callbacks are executed while holding the same interface mutex.
+   * @note The scheduled callback is either executed by the scheduler's own thread, or by the
+   *       shared SchedulerExecutor (if provided).
+   * @note Coroutines awaiting the scheduler (`awaitExecute`, `retryUntil`) are resumed on the scheduler
+   *       thread (or the executor) without holding the interface mutex. The scheduler must outlive them,
+   *       as the coroutines that are still suspended when the scheduler is destroyed are never resumed.
+   * @tparam T Type of the interface.
+   * @tparam MutexT Type of the interface mutex. If it supports the shared locking (e.g. `std::shared_timed_mutex`),
+   *                the const executions share the lock and only the non-const executions and the scheduled
+   *                callbacks take it exclusively. Opt in only if the const methods of T are safe to be called concurrently.
+   * @examples
+   * RetryScheduler<SettingsManagerInterface, std::shared_timed_mutex> scheduler{std::move(iface)};
+   * const auto &const_scheduler { scheduler };
+   *
+   * // Can be executed from multiple threads at the same time:
+   * const auto devices = const_scheduler.execute([](const SettingsManagerInterface& iface) {
+   *   return iface.enumAvailableDevices();
+   * });
+   * @examples_end
    */
-  template <class T>
+  template <class T, class MutexT = std::timed_mutex>
   class RetryScheduler final {
   public:
+    using JobId = std::uint64_t; /**< Identifier of the job scheduled via `scheduleJob`. */
+
     /**
-     * @brief Default constructor.
-     * @param iface Interface to be passed around to the executor functions.
+     * @brief Awaitable returned by the `awaitExecute` method.
      */
-    explicit RetryScheduler(std::unique_ptr<T> iface):
-        m_iface { iface ? std::move(iface) : throw std::logic_error { "Nullptr interface provided in RetryScheduler!" } },
-        m_thread { [this]() {
-          std::unique_lock lock { m_mutex };
-          while (m_keep_alive) {
-            m_syncing_thread = false;
-            if (auto duration { takeNextDuration(m_sleep_durations) }; duration > std::chrono::milliseconds::zero()) {
-              // We're going to sleep until manually woken up or the time elapses.
-              m_sleep_cv.wait_for(lock, duration, [this]() { return m_syncing_thread; });
+    template <class ResultT, class FunctionT>
+    class ExecuteAwaitable final {
+    public:
+      /**
+       * @brief Default constructor.
+       * @param scheduler Scheduler to execute the function on.
+       * @param exec_fn Function to be executed.
+       */
+      explicit ExecuteAwaitable(RetryScheduler &scheduler, FunctionT exec_fn):
+          m_scheduler { scheduler },
+          m_exec_fn { std::move(exec_fn) } {
+      }
+
+      /**
+       * @brief The function is always executed on the scheduler thread.
+       * @returns False.
+       */
+      [[nodiscard]] bool
+      await_ready() const noexcept {
+        return false;
+      }
+
+      /**
+       * @brief Queue the function for the execution.
+       * @param handle Coroutine to be resumed once the function is executed.
+       */
+      void
+      await_suspend(std::coroutine_handle<> handle) {
+        m_scheduler.queueAsyncTask(std::packaged_task<void()> { [this, handle]() {
+          try {
+            if constexpr (std::is_void_v<ResultT>) {
+              invokeUnlocked(m_scheduler, m_exec_fn);
             }
             else {
-              // We're going to sleep until manually woken up.
-              m_sleep_cv.wait(lock, [this]() { return m_syncing_thread; });
+              m_result.emplace(invokeUnlocked(m_scheduler, m_exec_fn));
             }
+          }
+          catch (...) {
+            m_exception = std::current_exception();
+          }
+          m_scheduler.queueUnlockedCallback([handle]() { handle.resume(); });
+        } });
+      }
 
-            if (m_syncing_thread) {
-              // Thread was waken up to sync sleep time or to be stopped.
-              continue;
-            }
+      /**
+       * @brief Get the result of the function.
+       * @returns The return value of the function (rethrows its exception, if any).
+       */
+      ResultT
+      await_resume() {
+        if (m_exception) {
+          std::rethrow_exception(m_exception);
+        }
 
-            try {
-              SchedulerStopToken scheduler_stop_token { [&]() { clearThreadLoopUnlocked(); } };
-              m_retry_function(*m_iface, scheduler_stop_token);
-              continue;
-            }
-            catch (const std::exception &error) {
-              DD_LOG(error) << "Exception thrown in the RetryScheduler thread. Stopping scheduler. Error:\n"
-                            << error.what();
-            }
+        if constexpr (!std::is_void_v<ResultT>) {
+          return std::move(*m_result);
+        }
+      }
+
+    private:
+      RetryScheduler &m_scheduler;
+      FunctionT m_exec_fn;
+      std::conditional_t<std::is_void_v<ResultT>, bool, std::optional<ResultT>> m_result {};
+      std::exception_ptr m_exception;
+    };
+
+    /**
+     * @brief Awaitable returned by the `retryUntil` method.
+     */
+    template <class PredicateT>
+    class RetryUntilAwaitable final {
+    public:
+      /**
+       * @brief Default constructor.
+       * @param scheduler Scheduler to evaluate the predicate on.
+       * @param predicate Predicate to be evaluated.
+       * @param policy Policy for the sleep durations between the evaluations.
+       */
+      explicit RetryUntilAwaitable(RetryScheduler &scheduler, PredicateT predicate, BackoffPolicy policy):
+          m_scheduler { scheduler },
+          m_predicate { std::move(predicate) },
+          m_policy { std::move(policy) } {
+      }
 
-            clearThreadLoopUnlocked();
+      /**
+       * @brief The predicate is always evaluated on the scheduler thread.
+       * @returns False.
+       */
+      [[nodiscard]] bool
+      await_ready() const noexcept {
+        return false;
+      }
+
+      /**
+       * @brief Queue the first evaluation of the predicate, followed by the retry job if needed.
+       * @param handle Coroutine to be resumed once the predicate is satisfied or the job is stopped.
+       */
+      void
+      await_suspend(std::coroutine_handle<> handle) {
+        m_scheduler.queueAsyncTask(std::packaged_task<void()> { [this, handle]() {
+          // The coroutine is resumed once the last reference to the completion is gone (including the retry job)
+          const auto completion { std::make_shared<Completion>(*this, handle) };
+          if (evaluate(*m_scheduler.m_iface)) {
+            return;
           }
-        } } {
+
+          static_cast<void>(m_scheduler.addJobUnlocked([completion](T &iface, SchedulerStopToken &stop_token) {
+            if (completion->m_awaitable.evaluate(iface)) {
+              stop_token.requestStop();
+            }
+          },
+            { .m_execution = SchedulerOptions::Execution::ScheduledOnly, .m_backoff_policy = std::move(m_policy) },
+            "RetryScheduler::retryUntil"));
+          m_scheduler.syncThreadUnlocked();
+        } });
+      }
+
+      /**
+       * @brief Get the result of the retries.
+       * @returns True if the predicate was satisfied, false if the retry job was stopped (rethrows the predicate's exception, if any).
+       */
+      bool
+      await_resume() {
+        if (m_exception) {
+          std::rethrow_exception(m_exception);
+        }
+        return m_satisfied;
+      }
+
+    private:
+      /**
+       * @brief Resumes the coroutine once destroyed.
+       */
+      struct Completion {
+        Completion(RetryUntilAwaitable &awaitable, std::coroutine_handle<> handle):
+            m_awaitable { awaitable },
+            m_handle { handle } {
+        }
+
+        ~Completion() {
+          m_awaitable.m_scheduler.queueUnlockedCallback([handle = m_handle]() { handle.resume(); });
+        }
+
+        Completion(const Completion &) = delete;
+        Completion &
+        operator=(const Completion &) = delete;
+
+        RetryUntilAwaitable &m_awaitable;
+        std::coroutine_handle<> m_handle;
+      };
+
+      /**
+       * @brief Evaluate the predicate.
+       * @param iface Interface for the predicate.
+       * @returns True if no more retries are needed.
+       */
+      bool
+      evaluate(T &iface) {
+        try {
+          m_satisfied = static_cast<bool>(m_predicate(iface));
+          return m_satisfied;
+        }
+        catch (...) {
+          m_exception = std::current_exception();
+        }
+        return true;
+      }
+
+      RetryScheduler &m_scheduler;
+      PredicateT m_predicate;
+      BackoffPolicy m_policy;
+      bool m_satisfied { false };
+      std::exception_ptr m_exception;
+    };
+
+    /**
+     * @brief Default constructor that starts a dedicated scheduler thread.
+     * @param iface Interface to be passed around to the executor functions.
+     */
+    explicit RetryScheduler(std::unique_ptr<T> iface):
+        RetryScheduler(std::move(iface), std::make_shared<SteadySchedulerClock>()) {
+    }
+
+    /**
+     * @brief Constructor that starts a dedicated scheduler thread using the provided clock for its deadlines.
+     * @param iface Interface to be passed around to the executor functions.
+     * @param clock Clock for the deadlines and the waiting (e.g. the ManualSchedulerClock for the tests).
+     * @note The metrics are always measured in the real time.
+     * @examples
+     * const auto clock { std::make_shared<ManualSchedulerClock>() };
+     * RetryScheduler<SettingsManagerInterface> scheduler { std::make_unique<SettingsManager>(...), clock };
+     * @examples_end
+     */
+    explicit RetryScheduler(std::unique_ptr<T> iface, std::shared_ptr<SchedulerClock> clock):
+        m_iface { iface ? std::move(iface) : throw std::logic_error { "Nullptr interface provided in RetryScheduler!" } },
+        m_clock { clock ? std::move(clock) : throw std::logic_error { "Nullptr clock provided in RetryScheduler!" } },
+        m_clock_subscription { m_clock->subscribe([this]() {
+          std::lock_guard wake_lock { m_wake_mutex };
+          m_sleep_cv.notify_one();
+        }) },
+        m_thread { [this]() { runThreadLoop(); } } {
+    }
+
+    /**
+     * @brief Constructor that uses the shared executor instead of a dedicated thread.
+     * @param iface Interface to be passed around to the executor functions.
+     * @param executor Executor for running the scheduled callback. It is kept alive by the scheduler.
+     * @note The executor always uses the std::chrono::steady_clock.
+     * @examples
+     * const auto executor { std::make_shared<SchedulerExecutor>() };
+     * RetryScheduler<SettingsManagerInterface> scheduler { std::make_unique<SettingsManager>(...), executor };
+     * @examples_end
+     */
+    explicit RetryScheduler(std::unique_ptr<T> iface, std::shared_ptr<SchedulerExecutor> executor):
+        m_iface { iface ? std::move(iface) : throw std::logic_error { "Nullptr interface provided in RetryScheduler!" } },
+        m_clock { std::make_shared<SteadySchedulerClock>() },
+        m_executor { executor ? std::move(executor) : throw std::logic_error { "Nullptr executor provided in RetryScheduler!" } },
+        m_timer { m_executor->createTimer([this]() { runTimerCallback(); }) } {
     }
 
     /**
-     * @brief A destructor that gracefully shuts down the thread.
+     * @brief A destructor that gracefully shuts down the thread (or waits for the callback running in the executor).
      */
     ~RetryScheduler() {
+      // No more wake-ups from the outside
+      m_event_sources.clear();
+
       {
         std::lock_guard lock { m_mutex };
         m_keep_alive = false;
         syncThreadUnlocked();
       }
 
-      m_thread.join();
+      if (m_timer) {
+        m_timer.reset();
+      }
+      else {
+        m_thread.join();
+      }
+
+      // Destroy the retry jobs while all the members are still alive (the suspended coroutines are not resumed)
+      clearJobsUnlocked();
+      m_unlocked_callbacks.clear();
     }
 
     /**
@@ -204,6 +483,8 @@ namespace display_device {
      *                the scheduler.
      * @param options Options for the scheduler.
      * @note Previously scheduled executor is replaced by a new one!
+     * @note Unless the call is merged with a previous one (see `SchedulerOptions::m_coalesce_window`), in which case
+     *       only the function of the pending job is replaced, or the call is dropped if the job has already been stopped.
      * @examples
      * std::unique_ptr<SettingsManagerInterface> iface = getIface(...);
      * RetryScheduler<SettingsManagerInterface> scheduler{std::move(iface)};
@@ -216,45 +497,124 @@ namespace display_device {
      * @examples_end
      */
     void
-    schedule(std::function<void(T &, SchedulerStopToken &stop_token)> exec_fn, const SchedulerOptions &options) {
-      if (!exec_fn) {
-        throw std::logic_error { "Empty callback function provided in RetryScheduler::schedule!" };
-      }
+    schedule(MoveOnlyFunction<void(T &, SchedulerStopToken &stop_token)> exec_fn, const SchedulerOptions &options) {
+      validateScheduleArguments(exec_fn, options, "RetryScheduler::schedule");
 
-      if (options.m_sleep_durations.empty()) {
-        throw std::logic_error { "At least 1 sleep duration must be specified in RetryScheduler::schedule!" };
+      std::lock_guard lock { m_mutex };
+      if (auto *coalesced { findCoalescedUnlocked(options) }) {
+        static_cast<void>(mergeCoalescedUnlocked(*coalesced, std::move(exec_fn)));
+        return;
       }
 
-      if (std::ranges::any_of(options.m_sleep_durations, [&](const auto &duration) { return duration == std::chrono::milliseconds::zero(); })) {
-        throw std::logic_error { "All of the durations specified in RetryScheduler::schedule must be larger than a 0!" };
+      if (m_replaceable_job) {
+        forgetCoalescedUnlocked(*m_replaceable_job);
+        removeJobUnlocked(*m_replaceable_job);
       }
 
+      m_replaceable_job = addJobUnlocked(std::move(exec_fn), options, "RetryScheduler::schedule");
+      syncThreadUnlocked();
+    }
+
+    /**
+     * @brief Schedule an additional job that runs next to the other scheduled jobs until it is stopped or cancelled.
+     * @param exec_fn Provides thread-safe access to the interface for executing arbitrary logic.
+     *                It accepts a `stop_token` as a second parameter which can be used to stop
+     *                this job only.
+     * @param options Options for the job.
+     * @returns Id of the job, or an empty optional if the job was stopped (or has failed) during the immediate execution.
+     * @note Unlike the `schedule` method, this does not replace any of the previously scheduled jobs.
+     * @note If the call is merged with a previous one (see `SchedulerOptions::m_coalesce_window`), the id of the
+     *       previous job is returned instead.
+     * @examples
+     * RetryScheduler<SettingsManagerInterface> scheduler{std::move(iface)};
+     *
+     * const auto probe_job = scheduler.scheduleJob([](SettingsManagerInterface& iface, SchedulerStopToken& stop_token){
+     *   static_cast<void>(iface.enumAvailableDevices());
+     * }, { .m_sleep_durations = { 5s } });
+     *
+     * if (probe_job) {
+     *   scheduler.cancel(*probe_job);
+     * }
+     * @examples_end
+     */
+    std::optional<JobId>
+    scheduleJob(MoveOnlyFunction<void(T &, SchedulerStopToken &stop_token)> exec_fn, const SchedulerOptions &options) {
+      validateScheduleArguments(exec_fn, options, "RetryScheduler::scheduleJob");
+
       std::lock_guard lock { m_mutex };
-      SchedulerStopToken stop_token { [&]() { stopUnlocked(); } };
+      if (auto *coalesced { findCoalescedUnlocked(options) }) {
+        return mergeCoalescedUnlocked(*coalesced, std::move(exec_fn));
+      }
 
-      // We are catching the exception here instead of propagating to have
-      // similar try...catch login as in the scheduler thread.
-      try {
-        auto sleep_durations = options.m_sleep_durations;
-        if (options.m_execution != SchedulerOptions::Execution::ScheduledOnly) {
-          if (options.m_execution == SchedulerOptions::Execution::ImmediateWithSleep) {
-            std::this_thread::sleep_for(takeNextDuration(sleep_durations));
-          }
+      auto job_id { addJobUnlocked(std::move(exec_fn), options, "RetryScheduler::scheduleJob") };
+      syncThreadUnlocked();
+      return job_id;
+    }
 
-          exec_fn(*m_iface, stop_token);
-        }
+    /**
+     * @brief Cancel a single job - it will no longer be executed once THIS method returns.
+     * @param job_id Id of the job to cancel.
+     * @returns True if the job was cancelled, false if it was no longer scheduled.
+     */
+    bool
+    cancel(const JobId job_id) {
+      std::lock_guard lock { m_mutex };
+      forgetCoalescedUnlocked(job_id);
+      if (!removeJobUnlocked(job_id)) {
+        return false;
+      }
 
-        if (!stop_token.stopRequested()) {
-          m_retry_function = std::move(exec_fn);
-          m_sleep_durations = std::move(sleep_durations);
-          syncThreadUnlocked();
-        }
+      syncThreadUnlocked();
+      return true;
+    }
+
+    /**
+     * @brief Execute all the scheduled jobs right away instead of waiting for their deadlines.
+     *
+     * The next deadlines are calculated from the backoff policies as usual.
+     *
+     * @note This method does not wait for the interface mutex, so it can be called from any thread
+     *       (including the scheduled functions and the platform notification handlers).
+     * @examples
+     * scheduler.schedule([](SettingsManagerInterface& iface, SchedulerStopToken& stop_token){
+     *   if (iface.applySettings(...) == SettingsManagerInterface::ApplyResult::Ok) {
+     *     stop_token.requestStop();
+     *   }
+     * }, { .m_sleep_durations = { 5000ms } });
+     *
+     * // The display has been reconnected, no need to wait for the whole 5 seconds
+     * scheduler.wakeNow();
+     * @examples_end
+     */
+    void
+    wakeNow() {
+      std::lock_guard wake_lock { m_wake_mutex };
+      m_wake_requested = true;
+      if (m_timer) {
+        m_timer->arm(std::chrono::steady_clock::now());
       }
-      catch (const std::exception &error) {
-        stop_token.requestStop();
-        DD_LOG(error) << "Exception thrown in the RetryScheduler::schedule. Stopping scheduler. Error:\n"
-                      << error.what();
+      else {
+        m_sleep_cv.notify_one();
+      }
+    }
+
+    /**
+     * @brief Wake up the scheduled jobs (via `wakeNow`) whenever the event source is triggered.
+     * @param event_source Event source to subscribe to. It is kept alive by the scheduler.
+     * @examples
+     * const auto device_arrival { std::make_shared<ManualSchedulerEventSource>() };
+     * scheduler.addEventSource(device_arrival);
+     * @examples_end
+     */
+    void
+    addEventSource(std::shared_ptr<SchedulerEventSource> event_source) {
+      if (!event_source) {
+        throw std::logic_error { "Nullptr event source provided in RetryScheduler::addEventSource!" };
       }
+
+      std::lock_guard lock { m_mutex };
+      auto subscription { event_source->subscribe([this]() { wakeNow(); }) };
+      m_event_sources.push_back({ std::move(event_source), std::move(subscription) });
     }
 
     /**
@@ -276,139 +636,998 @@ namespace display_device {
     }
 
     /**
-     * @brief Check whether anything is scheduled for execution.
-     * @return True if something is scheduled, false otherwise.
+     * @brief A non-const variant of the `executeBatchImpl` method. See it for details.
      */
-    [[nodiscard]] bool
-    isScheduled() const {
-      return static_cast<bool>(m_retry_function);
+    template <class... FunctionTs>
+      requires(sizeof...(FunctionTs) > 0)
+    auto
+    executeBatch(FunctionTs &&...exec_fns) {
+      return executeBatchImpl(*this, std::forward<FunctionTs>(exec_fns)...);
     }
 
     /**
-     * @brief Stop the scheduled function - will no longer be execute once THIS method returns.
+     * @brief A const variant of the `executeBatchImpl` method. See it for details.
      */
-    void
-    stop() {
-      std::lock_guard lock { m_mutex };
-      stopUnlocked();
+    template <class... FunctionTs>
+      requires(sizeof...(FunctionTs) > 0)
+    auto
+    executeBatch(FunctionTs &&...exec_fns) const {
+      return executeBatchImpl(*this, std::forward<FunctionTs>(exec_fns)...);
     }
 
-  private:
-    static std::chrono::milliseconds
-    takeNextDuration(std::vector<std::chrono::milliseconds> &durations) {
-      if (durations.size() > 1) {
-        const auto front_it { std::begin(durations) };
-        const auto front_value { *front_it };
-        durations.erase(front_it);
-        return front_value;
+    /**
+     * @brief Queue the function to be executed on the scheduler thread (or the executor) without blocking the caller.
+     * @param exec_fn Provides thread-safe access to the interface for executing arbitrary logic.
+     *                Accepts the same signatures as the `execute` method.
+     * @returns Future for the return value (or the exception) of the function. If the scheduler is destroyed
+     *          before the function is executed, the future holds the `std::future_error` (broken promise).
+     * @examples
+     * auto display_name = scheduler.executeAsync([&](SettingsManagerInterface& iface) {
+     *   return iface.getDisplayName(device_id);
+     * });
+     * // Do something else in the meantime...
+     * std::cout << display_name.get();
+     * @examples_end
+     */
+    template <class FunctionT>
+      requires detail::ExecuteCallbackLike<T, FunctionT>
+    auto
+    executeAsync(FunctionT &&exec_fn) {
+      if constexpr (detail::OptionalFunction<FunctionT>) {
+        if (!exec_fn) {
+          throw std::logic_error { "Empty callback function provided in RetryScheduler::executeAsync!" };
+        }
       }
 
-      return durations.empty() ? std::chrono::milliseconds::zero() : durations.back();
+      using ResultT = decltype(invokeUnlocked(std::declval<RetryScheduler &>(), std::declval<std::decay_t<FunctionT> &>()));
+      std::packaged_task<ResultT()> task { [this, exec_fn = std::forward<FunctionT>(exec_fn)]() mutable {
+        return invokeUnlocked(*this, exec_fn);
+      } };
+      auto future { task.get_future() };
+
+      queueAsyncTask(std::packaged_task<void()> { [task = std::move(task)]() mutable { task(); } });
+      return future;
     }
 
     /**
-     * @brief Execute arbitrary logic using the provided interface in a thread-safe manner.
-     * @param self A reference to *this.
+     * @brief Get an awaitable that executes the function on the scheduler thread (or the executor).
      * @param exec_fn Provides thread-safe access to the interface for executing arbitrary logic.
-     *                Acceptable function signatures are:
-     *                  - AnyReturnType(T &);
-     *                  - AnyReturnType(T &, SchedulerStopToken& stop_token),
-     *                    `stop_token` is an optional parameter that allows to stop scheduler during
-     *                    the same call.
-     * @return Return value from the executor callback.
-     * @note This method is not to be used directly. Intead the `execute` method is to be used.
+     *                Accepts the same signatures as the `execute` method.
+     * @returns Awaitable for the return value of the function. The awaiting coroutine is resumed on the
+     *          scheduler thread (or the executor).
      * @examples
-     * std::unique_ptr<SettingsManagerInterface> iface = getIface(...);
-     * RetryScheduler<SettingsManagerInterface> scheduler{std::move(iface)};
-     * const std::string device_id { "MY_DEVICE_ID" };
-     *
-     * // Without stop token:
-     * const auto display_name = scheduler.execute([&](SettingsManagerInterface& iface) {
-     *   return iface.getDisplayName(device_id);
-     * });
-     *
-     * // With stop token:
-     * scheduler.schedule([](SettingsManagerInterface& iface, SchedulerStopToken& stop_token) {
-     *   if (iface.revertSettings()) {
-     *     stop_token.requestStop();
-     *   }
-     * });
-     *
-     * scheduler.execute([&](SettingsManagerInterface& iface, SchedulerStopToken& stop_token) {
-     *   if (true) {
-     *     // Some condition was met and we no longer want to revert settings!
-     *     stop_token.requestStop();
-     *   }
+     * const bool applied = co_await scheduler.awaitExecute([&](SettingsManagerInterface& iface) {
+     *   return iface.applySettings(config) == SettingsManagerInterface::ApplyResult::Ok;
      * });
      * @examples_end
      */
-    static auto
-    executeImpl(auto &self, auto &&exec_fn)
-      requires detail::ExecuteCallbackLike<T, decltype(exec_fn)>
-    {
-      using FunctionT = decltype(exec_fn);
-      constexpr bool IsConst = std::is_const_v<std::remove_reference_t<decltype(self)>>;
-
+    template <class FunctionT>
+      requires detail::ExecuteCallbackLike<T, FunctionT>
+    [[nodiscard]] auto
+    awaitExecute(FunctionT &&exec_fn) {
       if constexpr (detail::OptionalFunction<FunctionT>) {
         if (!exec_fn) {
-          throw std::logic_error { "Empty callback function provided in RetryScheduler::execute!" };
+          throw std::logic_error { "Empty callback function provided in RetryScheduler::awaitExecute!" };
         }
       }
 
-      std::lock_guard lock { self.m_mutex };
-      detail::auto_const_t<std::decay_t<T>, IsConst> &iface_ref { *self.m_iface };
-      if constexpr (detail::ExecuteWithStopToken<T, FunctionT>) {
-        detail::auto_const_t<SchedulerStopToken, IsConst> stop_token { [&self]() {
-          if constexpr (!IsConst) {
-            self.stopUnlocked();
-          }
-        } };
-        return std::forward<FunctionT>(exec_fn)(iface_ref, stop_token);
-      }
-      else {
-        return std::forward<FunctionT>(exec_fn)(iface_ref);
+      using ResultT = decltype(invokeUnlocked(std::declval<RetryScheduler &>(), std::declval<std::decay_t<FunctionT> &>()));
+      return ExecuteAwaitable<ResultT, std::decay_t<FunctionT>> { *this, std::forward<FunctionT>(exec_fn) };
+    }
+
+    /**
+     * @brief Get an awaitable that evaluates the predicate on the scheduler thread (or the executor) until it is satisfied.
+     * @param predicate Predicate to be evaluated with the interface.
+     * @param policy Policy for the sleep durations between the evaluations.
+     * @returns Awaitable for the result (true if the predicate was satisfied, false if the retries were stopped
+     *          via the `stop` method or a stop token). The awaiting coroutine is resumed on the scheduler
+     *          thread (or the executor).
+     * @examples
+     * const bool reverted = co_await scheduler.retryUntil([](SettingsManagerInterface& iface) {
+     *   return iface.revertSettings();
+     * }, ExponentialBackoff { 50ms, 5s });
+     * @examples_end
+     */
+    template <class PredicateT>
+      requires std::predicate<PredicateT &, T &>
+    [[nodiscard]] auto
+    retryUntil(PredicateT &&predicate, BackoffPolicy policy) {
+      if constexpr (detail::OptionalFunction<PredicateT>) {
+        if (!predicate) {
+          throw std::logic_error { "Empty predicate provided in RetryScheduler::retryUntil!" };
+        }
       }
+
+      return RetryUntilAwaitable<std::decay_t<PredicateT>> { *this, std::forward<PredicateT>(predicate), std::move(policy) };
     }
 
     /**
-     * @brief Clear the necessary data so that the thread will go into a deep sleep.
+     * @brief A non-const variant of the `tryExecuteForImpl` method. See it for details.
      */
-    void
-    clearThreadLoopUnlocked() {
-      m_sleep_durations = {};
-      m_retry_function = nullptr;
+    template <class FunctionT>
+    auto
+    tryExecuteFor(const std::chrono::milliseconds timeout, FunctionT &&exec_fn) {
+      return tryExecuteForImpl(*this, timeout, std::forward<FunctionT>(exec_fn));
+    }
+
+    /**
+     * @brief A const variant of the `tryExecuteForImpl` method. See it for details.
+     */
+    template <class FunctionT>
+    auto
+    tryExecuteFor(const std::chrono::milliseconds timeout, FunctionT &&exec_fn) const {
+      return tryExecuteForImpl(*this, timeout, std::forward<FunctionT>(exec_fn));
+    }
+
+    /**
+     * @brief Check whether anything is scheduled for execution.
+     * @return True if something is scheduled, false otherwise.
+     * @note Does not take the interface mutex, so it can be called from the executed or scheduled functions as well.
+     */
+    [[nodiscard]] bool
+    isScheduled() const {
+      return m_job_count.load(std::memory_order_acquire) > 0;
     }
 
     /**
-     * @brief Manually wake up the thread for synchronization.
+     * @brief Check whether the job is still scheduled for execution.
+     * @param job_id Id of the job to check.
+     * @return True if the job is scheduled, false otherwise.
+     * @note Does not take the interface mutex, so it can be called from the executed or scheduled functions as well.
+     */
+    [[nodiscard]] bool
+    isScheduled(const JobId job_id) const {
+      std::lock_guard jobs_lock { m_jobs_mutex };
+      return m_jobs.contains(job_id);
+    }
+
+    /**
+     * @brief Get the scheduler metrics without taking the interface mutex.
+     * @returns The copy of the metrics.
+     * @examples
+     * const auto metrics { scheduler.getMetrics() };
+     * std::cout << metrics.m_attempts << " attempts, p99 lock wait " << metrics.m_lock_wait.getPercentile(99).count() << "us";
+     * @examples_end
+     */
+    [[nodiscard]] SchedulerMetricsSnapshot
+    getMetrics() const {
+      return m_metrics.getSnapshot();
+    }
+
+    /**
+     * @brief Stop all the scheduled functions - will no longer be execute once THIS method returns.
      */
     void
-    syncThreadUnlocked() {
-      m_syncing_thread = true;
-      m_sleep_cv.notify_one();
+    stop() {
+      std::lock_guard lock { m_mutex };
+      stopUnlocked();
+    }
+
+  private:
+    /**
+     * @brief A single scheduled job.
+     */
+    struct Job {
+      MoveOnlyFunction<void(T &, SchedulerStopToken &)> m_function; /**< Function to be executed until it succeeds. */
+      BackoffPolicy m_backoff_policy; /**< Policy for the sleep times of the job. */
+      std::chrono::steady_clock::time_point m_deadline; /**< Time point of the next execution. */
+      std::optional<std::chrono::steady_clock::time_point> m_scheduled_at; /**< Time point of scheduling (until the first execution). */
+      SchedulerOptions::Cadence m_cadence; /**< Specifies from which time point the sleep durations are measured. */
+      SchedulerOptions::CatchUp m_catch_up; /**< Catch-up logic for the missed deadlines. */
+      std::uint64_t m_attempts { 0 }; /**< Number of the executions so far. */
+      std::optional<std::uint64_t> m_max_attempts; /**< Maximum number of the executions. */
+      std::optional<std::chrono::steady_clock::time_point> m_give_up_at; /**< Time point after which no more executions are started. */
+      std::function<void()> m_on_exhausted; /**< Executed once the attempts or the time run out. */
+    };
+
+    /**
+     * @brief A coalescing window of the scheduling calls with the same key.
+     */
+    struct CoalescedSchedule {
+      std::chrono::steady_clock::time_point m_window_end; /**< Time point until which the calls are merged. */
+      std::optional<JobId> m_job_id; /**< Job that the calls are merged into (or empty if it was stopped during the immediate execution). */
+    };
+
+    /**
+     * @brief A subscribed event source.
+     */
+    struct EventSourceEntry {
+      std::shared_ptr<SchedulerEventSource> m_event_source; /**< Event source that is kept alive for the subscription. */
+      std::unique_ptr<SchedulerEventSource::Subscription> m_subscription; /**< Subscription to be destroyed before the event source. */
+    };
+
+    /**
+     * @brief An entry of the deadline heap.
+     */
+    struct DeadlineEntry {
+      std::chrono::steady_clock::time_point m_deadline;
+      JobId m_job_id;
+    };
+
+    /**
+     * @brief Comparator that turns the std heap algorithms into a min-heap by the deadline.
+     */
+    static bool
+    isLaterDeadline(const DeadlineEntry &lhs, const DeadlineEntry &rhs) {
+      return lhs.m_deadline > rhs.m_deadline;
+    }
+
+    /**
+     * @brief Validate the arguments of the schedule methods.
+     * @param exec_fn Function to be validated.
+     * @param options Options to be validated.
+     * @param method Name of the method for the error message.
+     */
+    static void
+    validateScheduleArguments(const MoveOnlyFunction<void(T &, SchedulerStopToken &)> &exec_fn, const SchedulerOptions &options, const std::string_view method) {
+      if (!exec_fn) {
+        throw std::logic_error { "Empty callback function provided in " + std::string { method } + "!" };
+      }
+
+      if (options.m_max_attempts && *options.m_max_attempts == 0) {
+        throw std::logic_error { "Maximum attempts must be larger than a 0 in " + std::string { method } + "!" };
+      }
+
+      if (options.m_timeout && *options.m_timeout < std::chrono::milliseconds::zero()) {
+        throw std::logic_error { "Timeout specified in " + std::string { method } + " must not be negative!" };
+      }
+
+      if (options.m_coalesce_window < std::chrono::milliseconds::zero()) {
+        throw std::logic_error { "Coalescing window specified in " + std::string { method } + " must not be negative!" };
+      }
+
+      if (options.m_backoff_policy) {
+        // The policies are validated on construction
+        return;
+      }
+
+      if (options.m_sleep_durations.empty()) {
+        throw std::logic_error { "At least 1 sleep duration must be specified in " + std::string { method } + "!" };
+      }
+
+      if (std::ranges::any_of(options.m_sleep_durations, [&](const auto &duration) { return duration <= std::chrono::milliseconds::zero(); })) {
+        throw std::logic_error { "All of the durations specified in " + std::string { method } + " must be larger than a 0!" };
+      }
+    }
+
+    /**
+     * @brief Perform the immediate execution (if requested) and add the new job.
+     * @param exec_fn Function to be executed.
+     * @param options Options for the job.
+     * @param method Name of the calling method for the log message.
+     * @returns Id of the added job, or an empty optional if the job was stopped or has failed.
+     * @note The coalescing window is only opened for the pending job or the job that was stopped,
+     *       so that the calls following a failed job are not dropped.
+     */
+    std::optional<JobId>
+    addJobUnlocked(MoveOnlyFunction<void(T &, SchedulerStopToken &)> exec_fn, const SchedulerOptions &options, const std::string_view method) {
+      // We are catching the exception here instead of propagating to have
+      // similar try...catch login as in the scheduler thread.
+      try {
+        const auto scheduled_at { std::chrono::steady_clock::now() };
+        const auto window_start { m_clock->now() };
+        BackoffPolicy backoff_policy { options.m_backoff_policy ? *options.m_backoff_policy : ListBackoff { options.m_sleep_durations } };
+        bool stop_requested { false };
+        const auto give_up_at { options.m_timeout ? std::make_optional(m_clock->now() + *options.m_timeout) : std::nullopt };
+        auto first_deadline { m_clock->now() };
+        if (options.m_execution != SchedulerOptions::Execution::ScheduledOnly) {
+          if (options.m_execution == SchedulerOptions::Execution::ImmediateWithSleep) {
+            m_clock->sleepFor(takeNextDuration(backoff_policy));
+            first_deadline = m_clock->now();
+          }
+
+          const auto started_at { std::chrono::steady_clock::now() };
+          m_metrics.recordFirstRunDelay(started_at - scheduled_at);
+          try {
+            SchedulerStopToken stop_token { [&stop_requested]() { stop_requested = true; } };
+            exec_fn(*m_iface, stop_token);
+          }
+          catch (...) {
+            m_metrics.recordAttempt(SchedulerMetrics::Outcome::Exception, std::chrono::steady_clock::now() - started_at);
+            throw;
+          }
+          m_metrics.recordAttempt(stop_requested ? SchedulerMetrics::Outcome::Success : SchedulerMetrics::Outcome::Retry, std::chrono::steady_clock::now() - started_at);
+        }
+
+        if (stop_requested) {
+          rememberCoalescedUnlocked(options, window_start, std::nullopt);
+          return std::nullopt;
+        }
+
+        // The immediate execution is treated as if it was scheduled at the time it started
+        const auto job_id { m_next_job_id++ };
+        const auto first_run_pending { options.m_execution == SchedulerOptions::Execution::ScheduledOnly };
+        auto &job { insertJobUnlocked(job_id, Job { .m_function = std::move(exec_fn),
+                                                    .m_backoff_policy = std::move(backoff_policy),
+                                                    .m_deadline = first_deadline,
+                                                    .m_scheduled_at = first_run_pending ? std::make_optional(scheduled_at) : std::nullopt,
+                                                    .m_cadence = options.m_cadence,
+                                                    .m_catch_up = options.m_catch_up,
+                                                    .m_attempts = first_run_pending ? 0u : 1u,
+                                                    .m_max_attempts = options.m_max_attempts,
+                                                    .m_give_up_at = give_up_at,
+                                                    .m_on_exhausted = options.m_on_exhausted }) };
+        if (!scheduleNextAttemptUnlocked(job_id, job)) {
+          return std::nullopt;
+        }
+
+        rememberCoalescedUnlocked(options, window_start, job_id);
+        return job_id;
+      }
+      catch (const std::exception &error) {
+        DD_LOG_CH(scheduler, error) << "Exception thrown in the " << method << ". Stopping scheduler. Error:\n"
+                                    << error.what();
+      }
+
+      return std::nullopt;
+    }
+
+    /**
+     * @brief Insert the new job.
+     * @param job_id Id of the job.
+     * @param job Job to be inserted.
+     * @returns Reference to the inserted job.
+     * @note The jobs are only inserted and removed while holding the `m_jobs_mutex` as well,
+     *       so that the `isScheduled` methods do not need the interface mutex.
+     */
+    Job &
+    insertJobUnlocked(const JobId job_id, Job job) {
+      std::lock_guard jobs_lock { m_jobs_mutex };
+      auto &inserted_job { m_jobs.emplace(job_id, std::move(job)).first->second };
+      m_job_count.store(m_jobs.size(), std::memory_order_release);
+      return inserted_job;
+    }
+
+    /**
+     * @brief Remove the job (its deadline entry is skipped lazily).
+     * @param job_id Id of the job to remove.
+     * @returns True if the job was removed, false if it did not exist.
+     */
+    bool
+    removeJobUnlocked(const JobId job_id) {
+      // The job is destroyed outside the `m_jobs_mutex`, in case its function captures something that checks the jobs
+      typename decltype(m_jobs)::node_type removed_job;
+      {
+        std::lock_guard jobs_lock { m_jobs_mutex };
+        removed_job = m_jobs.extract(job_id);
+        m_job_count.store(m_jobs.size(), std::memory_order_release);
+      }
+
+      if (!removed_job) {
+        return false;
+      }
+
+      if (m_replaceable_job == job_id) {
+        m_replaceable_job = std::nullopt;
+      }
+
+      if (m_jobs.empty()) {
+        m_deadlines.clear();
+      }
+      return true;
+    }
+
+    /**
+     * @brief Calculate the next deadline of the job after its execution according to its cadence.
+     * @param job Job whose `m_deadline` is still the one that has been reached.
+     * @returns The next deadline.
+     */
+    std::chrono::steady_clock::time_point
+    getNextJobDeadlineUnlocked(Job &job) {
+      const auto now { m_clock->now() };
+      auto duration { takeNextDuration(job.m_backoff_policy) };
+      if (job.m_cadence == SchedulerOptions::Cadence::FixedDelay || duration <= duration.zero()) {
+        return now + duration;
+      }
+
+      auto deadline { job.m_deadline + duration };
+      if (job.m_catch_up == SchedulerOptions::CatchUp::Skip) {
+        while (deadline < now) {
+          duration = takeNextDuration(job.m_backoff_policy);
+          if (duration <= duration.zero()) {
+            return now;
+          }
+          deadline += duration;
+        }
+      }
+
+      // Burst deadlines in the past are taken from the heap right away, in order with the other due jobs
+      return deadline;
+    }
+
+    /**
+     * @brief Find the coalescing window that the scheduling call falls into, while dropping the expired windows.
+     * @param options Options of the scheduling call.
+     * @returns The coalescing window or nullptr if the call is not to be merged.
+     */
+    CoalescedSchedule *
+    findCoalescedUnlocked(const SchedulerOptions &options) {
+      if (options.m_coalesce_window <= std::chrono::milliseconds::zero()) {
+        return nullptr;
+      }
+
+      const auto now { m_clock->now() };
+      std::erase_if(m_coalesced, [&now](const auto &item) { return item.second.m_window_end <= now; });
+
+      const auto it { m_coalesced.find(options.m_coalesce_key) };
+      return it != std::end(m_coalesced) ? &it->second : nullptr;
+    }
+
+    /**
+     * @brief Merge the scheduling call into the job of the coalescing window.
+     * @param coalesced The coalescing window.
+     * @param exec_fn Function that replaces the function of the pending job (keeping its deadline and backoff progress).
+     *                It is dropped if the job has already finished.
+     * @returns Id of the pending job or an empty optional if it has already finished.
+     */
+    std::optional<JobId>
+    mergeCoalescedUnlocked(const CoalescedSchedule &coalesced, MoveOnlyFunction<void(T &, SchedulerStopToken &)> exec_fn) {
+      if (!coalesced.m_job_id) {
+        return std::nullopt;
+      }
+
+      const auto it { m_jobs.find(*coalesced.m_job_id) };
+      if (it == std::end(m_jobs)) {
+        return std::nullopt;
+      }
+
+      it->second.m_function = std::move(exec_fn);
+      return coalesced.m_job_id;
+    }
+
+    /**
+     * @brief Open the coalescing window for the scheduling call (if enabled).
+     * @param options Options of the scheduling call.
+     * @param window_start Time point of the scheduling call.
+     * @param job_id Id of the pending job (or an empty optional if it was stopped during the immediate execution).
+     */
+    void
+    rememberCoalescedUnlocked(const SchedulerOptions &options, const std::chrono::steady_clock::time_point window_start, const std::optional<JobId> job_id) {
+      if (options.m_coalesce_window > std::chrono::milliseconds::zero()) {
+        m_coalesced[options.m_coalesce_key] = { window_start + options.m_coalesce_window, job_id };
+      }
+    }
+
+    /**
+     * @brief Close the coalescing windows of the job that has been cancelled or has failed (so that the new calls are no longer dropped).
+     * @param job_id Id of the job.
+     */
+    void
+    forgetCoalescedUnlocked(const JobId job_id) {
+      std::erase_if(m_coalesced, [job_id](const auto &item) { return item.second.m_job_id == job_id; });
+    }
+
+    /**
+     * @brief Calculate and push the next deadline of the job, or remove the job if it has run out of attempts or time.
+     * @param job_id Id of the job.
+     * @param job Job that has been executed (or added).
+     * @returns True if the job is still scheduled, false if it has been removed.
+     */
+    bool
+    scheduleNextAttemptUnlocked(const JobId job_id, Job &job) {
+      job.m_deadline = getNextJobDeadlineUnlocked(job);
+      if ((job.m_max_attempts && job.m_attempts >= *job.m_max_attempts) || (job.m_give_up_at && job.m_deadline > *job.m_give_up_at)) {
+        DD_LOG_CH(scheduler, warning) << "RetryScheduler job has run out of attempts (" << job.m_attempts << ") or time. Giving up.";
+        m_metrics.recordExhausted();
+        if (job.m_on_exhausted) {
+          queueUnlockedCallback(std::move(job.m_on_exhausted));
+        }
+
+        forgetCoalescedUnlocked(job_id);
+        removeJobUnlocked(job_id);
+        return false;
+      }
+
+      pushDeadlineUnlocked(job_id, job.m_deadline);
+      return true;
+    }
+
+    /**
+     * @brief Add the job deadline to the heap.
+     * @param job_id Id of the job.
+     * @param deadline Deadline of the job.
+     */
+    void
+    pushDeadlineUnlocked(const JobId job_id, const std::chrono::steady_clock::time_point deadline) {
+      m_deadlines.push_back({ deadline, job_id });
+      std::ranges::push_heap(m_deadlines, isLaterDeadline);
+    }
+
+    /**
+     * @brief Get the earliest deadline of the scheduled jobs, while dropping the stale heap entries.
+     * @returns The earliest deadline or an empty optional if nothing is scheduled.
+     */
+    std::optional<std::chrono::steady_clock::time_point>
+    getNextDeadlineUnlocked() {
+      while (!m_deadlines.empty()) {
+        const auto &entry { m_deadlines.front() };
+        if (const auto it { m_jobs.find(entry.m_job_id) }; it != std::end(m_jobs) && it->second.m_deadline == entry.m_deadline) {
+          return entry.m_deadline;
+        }
+
+        std::ranges::pop_heap(m_deadlines, isLaterDeadline);
+        m_deadlines.pop_back();
+      }
+
+      return std::nullopt;
+    }
+
+    /**
+     * @brief Main loop of the dedicated scheduler thread.
+     */
+    void
+    runThreadLoop() {
+      std::unique_lock lock { m_mutex };
+      while (m_keep_alive) {
+        runAsyncTasksUnlocked();
+        runDueJobsUnlocked();
+        const auto deadline { getNextDeadlineUnlocked() };
+        lock.unlock();
+
+        runUnlockedCallbacks();
+        {
+          // The interface mutex is not held while sleeping, so that the async tasks can be queued without waiting for it.
+          std::unique_lock wake_lock { m_wake_mutex };
+          const auto wake_up_predicate { [this]() { return m_syncing_thread || m_wake_requested || !m_async_tasks.empty() || !m_unlocked_callbacks.empty(); } };
+          if (deadline) {
+            // We're going to sleep until manually woken up or the deadline is reached.
+            m_clock->waitUntil(m_sleep_cv, wake_lock, *deadline, wake_up_predicate);
+          }
+          else {
+            // We're going to sleep until manually woken up.
+            m_sleep_cv.wait(wake_lock, wake_up_predicate);
+          }
+          m_syncing_thread = false;
+        }
+
+        lock.lock();
+      }
+    }
+
+    /**
+     * @brief Timer callback used when running in the shared executor.
+     */
+    void
+    runTimerCallback() {
+      {
+        // The shared worker must not be parked while the interface is in use (e.g. by a long `execute`),
+        // otherwise the timers of the other schedulers would be stalled as well. Try again shortly instead.
+        std::unique_lock lock { m_mutex, std::try_to_lock };
+        if (!lock.owns_lock()) {
+          constexpr std::chrono::milliseconds retry_delay { 1 };
+          std::lock_guard wake_lock { m_wake_mutex };
+          m_timer->arm(std::chrono::steady_clock::now() + retry_delay);
+          return;
+        }
+
+        if (m_keep_alive) {
+          runAsyncTasksUnlocked();
+          runDueJobsUnlocked();
+        }
+
+        // Re-arms the timer for the next deadline.
+        syncThreadUnlocked();
+      }
+
+      runUnlockedCallbacks();
+    }
+
+    /**
+     * @brief Queue the task to be executed on the scheduler thread (or the executor).
+     * @param task Task to be queued.
+     */
+    void
+    queueAsyncTask(std::packaged_task<void()> task) {
+      std::lock_guard wake_lock { m_wake_mutex };
+      m_async_tasks.push_back(std::move(task));
+      if (m_timer) {
+        m_timer->arm(std::chrono::steady_clock::now());
+      }
+      else {
+        m_sleep_cv.notify_one();
+      }
+    }
+
+    /**
+     * @brief Queue the callback (e.g. coroutine resumption) to be executed once the interface mutex is released.
+     * @param callback Callback to be executed.
+     */
+    void
+    queueUnlockedCallback(MoveOnlyFunction<void()> callback) {
+      std::lock_guard wake_lock { m_wake_mutex };
+      m_unlocked_callbacks.push_back(std::move(callback));
+      m_syncing_thread = true;
+      m_sleep_cv.notify_one();
+    }
+
+    /**
+     * @brief Execute the queued callbacks (the interface mutex must NOT be held).
+     */
+    void
+    runUnlockedCallbacks() {
+      std::vector<MoveOnlyFunction<void()>> callbacks;
+      {
+        std::lock_guard wake_lock { m_wake_mutex };
+        callbacks.swap(m_unlocked_callbacks);
+      }
+
+      for (auto &callback : callbacks) {
+        try {
+          callback();
+        }
+        catch (const std::exception &error) {
+          DD_LOG_CH(scheduler, error) << "Exception thrown in the RetryScheduler thread callback. Error:\n"
+                                      << error.what();
+        }
+      }
+    }
+
+    /**
+     * @brief Execute the queued async tasks.
+     */
+    void
+    runAsyncTasksUnlocked() {
+      std::deque<std::packaged_task<void()>> tasks;
+      {
+        std::lock_guard wake_lock { m_wake_mutex };
+        tasks.swap(m_async_tasks);
+      }
+
+      for (auto &task : tasks) {
+        // The exceptions are stored in the futures
+        task();
+      }
+    }
+
+    /**
+     * @brief Take (and reset) the pending `wakeNow` request.
+     * @returns True if the wake-up has been requested.
+     */
+    bool
+    takeWakeRequest() {
+      std::lock_guard wake_lock { m_wake_mutex };
+      return std::exchange(m_wake_requested, false);
+    }
+
+    /**
+     * @brief Execute the jobs whose deadline has been reached and calculate their next deadlines.
+     */
+    void
+    runDueJobsUnlocked() {
+      // The time is sampled only once, so that the fast jobs cannot starve the others forever
+      const auto now { m_clock->now() };
+      if (takeWakeRequest()) {
+        for (auto &[job_id, job] : m_jobs) {
+          // Jobs that are already due must not end up in the heap twice
+          if (job.m_deadline > now) {
+            job.m_deadline = now;
+            pushDeadlineUnlocked(job_id, now);
+          }
+        }
+      }
+
+      for (auto deadline { getNextDeadlineUnlocked() }; deadline && *deadline <= now; deadline = getNextDeadlineUnlocked()) {
+        const auto job_id { m_deadlines.front().m_job_id };
+        std::ranges::pop_heap(m_deadlines, isLaterDeadline);
+        m_deadlines.pop_back();
+
+        auto &job { m_jobs.at(job_id) };
+        ++job.m_attempts;
+        const auto started_at { std::chrono::steady_clock::now() };
+        if (job.m_scheduled_at) {
+          m_metrics.recordFirstRunDelay(started_at - *job.m_scheduled_at);
+          job.m_scheduled_at = std::nullopt;
+        }
+
+        bool stop_requested { false };
+        auto outcome { SchedulerMetrics::Outcome::Retry };
+        try {
+          SchedulerStopToken scheduler_stop_token { [&stop_requested]() { stop_requested = true; } };
+          job.m_function(*m_iface, scheduler_stop_token);
+        }
+        catch (const std::exception &error) {
+          DD_LOG_CH(scheduler, error) << "Exception thrown in the RetryScheduler thread. Stopping scheduler. Error:\n"
+                                      << error.what();
+          outcome = SchedulerMetrics::Outcome::Exception;
+          stop_requested = true;
+        }
+
+        if (stop_requested && outcome != SchedulerMetrics::Outcome::Exception) {
+          outcome = SchedulerMetrics::Outcome::Success;
+        }
+        m_metrics.recordAttempt(outcome, std::chrono::steady_clock::now() - started_at);
+
+        if (stop_requested) {
+          if (outcome == SchedulerMetrics::Outcome::Exception) {
+            forgetCoalescedUnlocked(job_id);
+          }
+          removeJobUnlocked(job_id);
+          continue;
+        }
+
+        static_cast<void>(scheduleNextAttemptUnlocked(job_id, job));
+      }
+    }
+
+    /**
+     * @brief Execute arbitrary logic using the provided interface in a thread-safe manner.
+     * @param self A reference to *this.
+     * @param exec_fn Provides thread-safe access to the interface for executing arbitrary logic.
+     *                Acceptable function signatures are:
+     *                  - AnyReturnType(T &);
+     *                  - AnyReturnType(T &, SchedulerStopToken& stop_token),
+     *                    `stop_token` is an optional parameter that allows to stop scheduler during
+     *                    the same call.
+     * @return Return value from the executor callback.
+     * @note This method is not to be used directly. Intead the `execute` method is to be used.
+     * @examples
+     * std::unique_ptr<SettingsManagerInterface> iface = getIface(...);
+     * RetryScheduler<SettingsManagerInterface> scheduler{std::move(iface)};
+     * const std::string device_id { "MY_DEVICE_ID" };
+     *
+     * // Without stop token:
+     * const auto display_name = scheduler.execute([&](SettingsManagerInterface& iface) {
+     *   return iface.getDisplayName(device_id);
+     * });
+     *
+     * // With stop token:
+     * scheduler.schedule([](SettingsManagerInterface& iface, SchedulerStopToken& stop_token) {
+     *   if (iface.revertSettings()) {
+     *     stop_token.requestStop();
+     *   }
+     * });
+     *
+     * scheduler.execute([&](SettingsManagerInterface& iface, SchedulerStopToken& stop_token) {
+     *   if (true) {
+     *     // Some condition was met and we no longer want to revert settings!
+     *     stop_token.requestStop();
+     *   }
+     * });
+     * @examples_end
+     */
+    static auto
+    executeImpl(auto &self, auto &&exec_fn)
+      requires detail::ExecuteCallbackLike<T, decltype(exec_fn)>
+    {
+      using FunctionT = decltype(exec_fn);
+
+      if constexpr (detail::OptionalFunction<FunctionT>) {
+        if (!exec_fn) {
+          throw std::logic_error { "Empty callback function provided in RetryScheduler::execute!" };
+        }
+      }
+
+      const auto wait_started_at { std::chrono::steady_clock::now() };
+      const auto lock { acquireLock(self) };
+      self.m_metrics.recordLockWait(std::chrono::steady_clock::now() - wait_started_at);
+      return invokeUnlocked(self, std::forward<FunctionT>(exec_fn));
+    }
+
+    /**
+     * @brief Execute arbitrary logic using the provided interface if the lock can be acquired in time.
+     * @param self A reference to *this.
+     * @param timeout Maximum time to wait for the lock (e.g. while the scheduled callback is running).
+     * @param exec_fn Provides thread-safe access to the interface for executing arbitrary logic.
+     *                Accepts the same signatures as the `execute` method.
+     * @return True (or the return value from the executor callback wrapped in an optional) if the callback
+     *         was executed, false (or an empty optional) if the lock could not be acquired in time.
+     * @note This method is not to be used directly. Intead the `tryExecuteFor` method is to be used.
+     * @examples
+     * const auto display_name = scheduler.tryExecuteFor(100ms, [&](SettingsManagerInterface& iface) {
+     *   return iface.getDisplayName(device_id);
+     * });
+     * if (!display_name) {
+     *   // Scheduler is busy, try again later
+     * }
+     * @examples_end
+     */
+    static auto
+    tryExecuteForImpl(auto &self, const std::chrono::milliseconds timeout, auto &&exec_fn)
+      requires detail::ExecuteCallbackLike<T, decltype(exec_fn)>
+    {
+      using FunctionT = decltype(exec_fn);
+      using ResultT = decltype(invokeUnlocked(self, std::forward<FunctionT>(exec_fn)));
+
+      if constexpr (detail::OptionalFunction<FunctionT>) {
+        if (!exec_fn) {
+          throw std::logic_error { "Empty callback function provided in RetryScheduler::tryExecuteFor!" };
+        }
+      }
+
+      const auto wait_started_at { std::chrono::steady_clock::now() };
+      const auto lock { acquireLock(self, timeout) };
+      self.m_metrics.recordLockWait(std::chrono::steady_clock::now() - wait_started_at);
+      if constexpr (std::is_void_v<ResultT>) {
+        if (!lock.owns_lock()) {
+          return false;
+        }
+
+        invokeUnlocked(self, std::forward<FunctionT>(exec_fn));
+        return true;
+      }
+      else {
+        if (!lock.owns_lock()) {
+          return std::optional<ResultT> {};
+        }
+
+        return std::optional<ResultT> { invokeUnlocked(self, std::forward<FunctionT>(exec_fn)) };
+      }
+    }
+
+    /**
+     * @brief Execute multiple functions one after another while holding the interface mutex only once.
+     * @param self A reference to *this.
+     * @param exec_fns Functions to be executed in the order they are provided.
+     *                 Accept the same signatures as the `execute` method.
+     * @return Tuple of the return values (`std::monostate` for the functions returning void).
+     * @note If any of the functions throws, the remaining ones are not executed.
+     * @note This method is not to be used directly. Intead the `executeBatch` method is to be used.
+     * @examples
+     * const auto [devices, display_name] = scheduler.executeBatch(
+     *   [](SettingsManagerInterface& iface) { return iface.enumAvailableDevices(); },
+     *   [&](SettingsManagerInterface& iface) { return iface.getDisplayName(device_id); });
+     * @examples_end
+     */
+    static auto
+    executeBatchImpl(auto &self, auto &&...exec_fns)
+      requires(detail::ExecuteCallbackLike<T, decltype(exec_fns)> && ...)
+    {
+      const auto validate { [](const auto &exec_fn) {
+        if constexpr (detail::OptionalFunction<decltype(exec_fn)>) {
+          if (!exec_fn) {
+            throw std::logic_error { "Empty callback function provided in RetryScheduler::executeBatch!" };
+          }
+        }
+      } };
+      (validate(exec_fns), ...);
+
+      const auto wait_started_at { std::chrono::steady_clock::now() };
+      const auto lock { acquireLock(self) };
+      self.m_metrics.recordLockWait(std::chrono::steady_clock::now() - wait_started_at);
+
+      // The braced initialization guarantees the left-to-right execution order
+      using ResultT = std::tuple<detail::batch_result_t<decltype(invokeUnlocked(self, std::forward<decltype(exec_fns)>(exec_fns)))>...>;
+      return ResultT { invokeBatchItemUnlocked(self, std::forward<decltype(exec_fns)>(exec_fns))... };
+    }
+
+    /**
+     * @brief Execute the function of the batch (the lock must be held).
+     * @param self A reference to *this.
+     * @param exec_fn Function to be executed.
+     * @return Return value from the function or `std::monostate` if it returns void.
+     */
+    static decltype(auto)
+    invokeBatchItemUnlocked(auto &self, auto &&exec_fn) {
+      using FunctionT = decltype(exec_fn);
+      if constexpr (std::is_void_v<decltype(invokeUnlocked(self, std::forward<FunctionT>(exec_fn)))>) {
+        invokeUnlocked(self, std::forward<FunctionT>(exec_fn));
+        return std::monostate {};
+      }
+      else {
+        return invokeUnlocked(self, std::forward<FunctionT>(exec_fn));
+      }
+    }
+
+    /**
+     * @brief Lock the interface mutex - in a shared mode for the const access if the mutex supports it, exclusively otherwise.
+     * @param self A reference to *this.
+     * @param timeout Optional timeout for acquiring the lock.
+     * @return The lock (check `owns_lock` if the timeout was specified).
+     */
+    static auto
+    acquireLock(auto &self, const auto &...timeout) {
+      constexpr bool IsConst = std::is_const_v<std::remove_reference_t<decltype(self)>>;
+      if constexpr (IsConst && detail::SharedTimedLockable<MutexT>) {
+        return std::shared_lock<MutexT> { self.m_mutex, timeout... };
+      }
+      else {
+        return std::unique_lock<MutexT> { self.m_mutex, timeout... };
+      }
+    }
+
+    /**
+     * @brief Execute arbitrary logic using the provided interface (the lock must be held).
+     * @param self A reference to *this.
+     * @param exec_fn Provides thread-safe access to the interface for executing arbitrary logic.
+     * @return Return value from the executor callback.
+     */
+    static auto
+    invokeUnlocked(auto &self, auto &&exec_fn) {
+      using FunctionT = decltype(exec_fn);
+      constexpr bool IsConst = std::is_const_v<std::remove_reference_t<decltype(self)>>;
+
+      detail::auto_const_t<std::decay_t<T>, IsConst> &iface_ref { *self.m_iface };
+      if constexpr (detail::ExecuteWithStopToken<T, FunctionT>) {
+        detail::auto_const_t<SchedulerStopToken, IsConst> stop_token { [&self]() {
+          if constexpr (!IsConst) {
+            self.stopUnlocked();
+          }
+        } };
+        return std::forward<FunctionT>(exec_fn)(iface_ref, stop_token);
+      }
+      else {
+        return std::forward<FunctionT>(exec_fn)(iface_ref);
+      }
+    }
+
+    /**
+     * @brief Manually wake up the thread (or re-arm the executor timer) for synchronization.
+     */
+    void
+    syncThreadUnlocked() {
+      const auto deadline { m_keep_alive ? getNextDeadlineUnlocked() : std::nullopt };
+
+      // Timer must be re-armed under the same lock as in `executeAsync`, otherwise the async task could be left waiting.
+      std::lock_guard wake_lock { m_wake_mutex };
+      if (m_timer) {
+        if (m_keep_alive && (m_wake_requested || !m_async_tasks.empty() || !m_unlocked_callbacks.empty())) {
+          m_timer->arm(std::chrono::steady_clock::now());
+        }
+        else if (deadline) {
+          m_timer->arm(*deadline);
+        }
+        else {
+          m_timer->disarm();
+        }
+        return;
+      }
+
+      m_syncing_thread = true;
+      m_sleep_cv.notify_one();
+    }
+
+    /**
+     * @brief Remove all the jobs (destroying them outside the `m_jobs_mutex`).
+     */
+    void
+    clearJobsUnlocked() {
+      decltype(m_jobs) removed_jobs;
+      {
+        std::lock_guard jobs_lock { m_jobs_mutex };
+        removed_jobs.swap(m_jobs);
+        m_job_count.store(0, std::memory_order_release);
+      }
     }
 
     /**
-     * @brief Stop the scheduled function.
+     * @brief Stop all the scheduled functions.
      */
     void
     stopUnlocked() {
-      if (isScheduled()) {
-        clearThreadLoopUnlocked();
+      m_coalesced.clear();
+      if (!m_jobs.empty()) {
+        clearJobsUnlocked();
+        m_deadlines.clear();
+        m_replaceable_job = std::nullopt;
         syncThreadUnlocked();
       }
     }
 
     std::unique_ptr<T> m_iface; /**< Interface to be passed around to the executor functions. */
-    std::vector<std::chrono::milliseconds> m_sleep_durations; /**< Sleep times for the timer. */
-    std::function<void(T &, SchedulerStopToken &)> m_retry_function { nullptr }; /**< Function to be executed until it succeeds. */
+    std::shared_ptr<SchedulerClock> m_clock; /**< Clock for the deadlines. */
+    std::unordered_map<JobId, Job> m_jobs; /**< All of the scheduled jobs. */
+    std::vector<DeadlineEntry> m_deadlines; /**< Min-heap of the job deadlines (entries of the removed jobs are dropped lazily). */
+    std::optional<JobId> m_replaceable_job; /**< Job that is replaced by the `schedule` method. */
+    JobId m_next_job_id { 0 }; /**< Id for the next job. */
+    std::vector<EventSourceEntry> m_event_sources; /**< Event sources triggering the `wakeNow`. */
+    std::unordered_map<std::string, CoalescedSchedule> m_coalesced; /**< Open coalescing windows by their key. */
 
-    mutable std::mutex m_mutex {}; /**< A mutex for synchronizing thread and "external" access. */
+    mutable MutexT m_mutex {}; /**< A mutex for synchronizing thread and "external" access. */
+    mutable std::mutex m_jobs_mutex {}; /**< A mutex held while inserting or removing the jobs (never held while executing the functions). */
+    std::atomic<std::size_t> m_job_count { 0 }; /**< Number of the scheduled jobs for the lock-free `isScheduled` check. */
+    std::mutex m_wake_mutex {}; /**< A mutex for waking up the thread and for the async tasks (never held while executing the functions). */
     std::condition_variable m_sleep_cv {}; /**< Condition variable for waking up thread. */
     bool m_syncing_thread { false }; /**< Safeguard for the condition variable to prevent sporadic thread wake-ups. */
+    bool m_wake_requested { false }; /**< Set by `wakeNow` to execute all the jobs right away. */
+    std::deque<std::packaged_task<void()>> m_async_tasks; /**< Tasks queued via `executeAsync`. */
+    std::vector<MoveOnlyFunction<void()>> m_unlocked_callbacks; /**< Callbacks (e.g. coroutines to be resumed) waiting for the interface mutex to be released. */
+    mutable SchedulerMetrics m_metrics; /**< Lock-free metrics (updated from the const executions as well). */
     bool m_keep_alive { true }; /**< When set to false, scheduler thread will exit. */
 
     // Always the last in the list so that all the members are already initialized!
-    std::thread m_thread; /**< A scheduler thread. */
+    std::unique_ptr<SchedulerClock::Subscription> m_clock_subscription; /**< Wakes up the thread whenever the clock jumps. */
+    std::shared_ptr<SchedulerExecutor> m_executor; /**< Shared executor (if not using the dedicated thread). */
+    std::unique_ptr<SchedulerExecutor::Timer> m_timer; /**< Timer in the shared executor (if not using the dedicated thread). */
+    std::thread m_thread; /**< A scheduler thread (if not using the shared executor). */
   };
 }  // namespace display_device
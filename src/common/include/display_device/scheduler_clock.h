@@ -0,0 +1,141 @@
+/**
+ * @file src/common/include/display_device/scheduler_clock.h
+ * @brief Declarations for the clocks used by the RetryScheduler.
+ */
+#pragma once
+
+// system includes
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+// local includes
+#include "scheduler_event_source.h"
+
+namespace display_device {
+  /**
+   * @brief Clock and wait policy used by the RetryScheduler for its deadlines.
+   */
+  class SchedulerClock {
+  public:
+    using time_point = std::chrono::steady_clock::time_point; /**< Time point of the clock. */
+    using duration = std::chrono::steady_clock::duration; /**< Duration of the clock. */
+    using Subscription = SchedulerEventSource::Subscription; /**< Keeps the callback registered until destroyed. */
+
+    /**
+     * @brief Default virtual destructor.
+     */
+    virtual ~SchedulerClock() = default;
+
+    /**
+     * @brief Get the current time.
+     * @returns The current time.
+     */
+    [[nodiscard]] virtual time_point
+    now() const = 0;
+
+    /**
+     * @brief Put the calling thread to sleep.
+     * @param time Duration to sleep for.
+     */
+    virtual void
+    sleepFor(duration time) = 0;
+
+    /**
+     * @brief Wait until the deadline is reached or the predicate is satisfied.
+     * @param cv Condition variable to wait on.
+     * @param lock Lock for the condition variable.
+     * @param deadline Time point (of this clock) to wait until.
+     * @param predicate Predicate to be checked when woken up.
+     * @returns The predicate result.
+     */
+    virtual bool
+    waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, time_point deadline, const std::function<bool()> &predicate) = 0;
+
+    /**
+     * @brief Register a callback to be invoked whenever the time jumps (the waiting threads need to be woken up).
+     * @param callback Callback to be invoked. It must not call back into the clock.
+     * @returns The subscription or nullptr if the time never jumps.
+     */
+    [[nodiscard]] virtual std::unique_ptr<Subscription>
+    subscribe(std::function<void()> callback) = 0;
+  };
+
+  /**
+   * @brief The default clock that uses the std::chrono::steady_clock.
+   */
+  class SteadySchedulerClock final: public SchedulerClock {
+  public:
+    [[nodiscard]] time_point
+    now() const override;
+
+    void
+    sleepFor(duration time) override;
+
+    bool
+    waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, time_point deadline, const std::function<bool()> &predicate) override;
+
+    [[nodiscard]] std::unique_ptr<Subscription>
+    subscribe(std::function<void()> callback) override;
+  };
+
+  /**
+   * @brief A virtual clock that only moves when advanced manually.
+   *
+   * Allows the tests to advance the time instantly instead of sleeping.
+   *
+   * @examples
+   * const auto clock { std::make_shared<ManualSchedulerClock>() };
+   * RetryScheduler<SettingsManagerInterface> scheduler { std::make_unique<SettingsManager>(...), clock };
+   * scheduler.schedule(..., { .m_sleep_durations = { 5s } });
+   * clock->advance(5s);  // The callback is executed right away
+   * @examples_end
+   */
+  class ManualSchedulerClock final: public SchedulerClock {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param start The initial time.
+     */
+    explicit ManualSchedulerClock(time_point start = {});
+
+    [[nodiscard]] time_point
+    now() const override;
+
+    /**
+     * @brief Advances the time instead of sleeping.
+     * @param time Duration to advance the time by.
+     */
+    void
+    sleepFor(duration time) override;
+
+    bool
+    waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, time_point deadline, const std::function<bool()> &predicate) override;
+
+    [[nodiscard]] std::unique_ptr<Subscription>
+    subscribe(std::function<void()> callback) override;
+
+    /**
+     * @brief Advance the time and wake up the waiting threads.
+     * @param time Duration to advance the time by (negative values are ignored).
+     */
+    void
+    advance(duration time);
+
+    /**
+     * @brief Get the number of threads currently waiting in the `waitUntil`.
+     * @returns The number of waiting threads.
+     * @note Allows the tests to advance the time only after the deadline has been set.
+     */
+    [[nodiscard]] std::size_t
+    getWaiterCount() const;
+
+  private:
+    std::atomic<duration::rep> m_now; /**< Time since the clock's epoch. */
+    std::atomic<std::size_t> m_waiter_count { 0 };
+    ManualSchedulerEventSource m_time_jumps; /**< Notified whenever the time is advanced. */
+  };
+}  // namespace display_device
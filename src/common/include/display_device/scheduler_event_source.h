@@ -0,0 +1,76 @@
+/**
+ * @file src/common/include/display_device/scheduler_event_source.h
+ * @brief Declarations for the event sources that can wake up the RetryScheduler.
+ */
+#pragma once
+
+// system includes
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace display_device {
+  /**
+   * @brief A source of the external events (e.g. device arrival) that should trigger the scheduled retries right away.
+   */
+  class SchedulerEventSource {
+  public:
+    /**
+     * @brief Keeps the callback registered until destroyed.
+     */
+    class Subscription {
+    public:
+      /**
+       * @brief Default virtual destructor.
+       */
+      virtual ~Subscription() = default;
+    };
+
+    /**
+     * @brief Default virtual destructor.
+     */
+    virtual ~SchedulerEventSource() = default;
+
+    /**
+     * @brief Register a callback to be invoked whenever the event happens.
+     * @param callback Callback to be invoked (from any thread). It must not call back into the event source.
+     * @returns The subscription. The callback is no longer invoked once it is destroyed.
+     */
+    [[nodiscard]] virtual std::unique_ptr<Subscription>
+    subscribe(std::function<void()> callback) = 0;
+  };
+
+  /**
+   * @brief An event source that is triggered manually.
+   *
+   * Can be used as a bridge for the platform notifications or the file descriptor readiness callbacks.
+   *
+   * @examples
+   * const auto device_arrival { std::make_shared<ManualSchedulerEventSource>() };
+   * scheduler.addEventSource(device_arrival);
+   *
+   * // Somewhere in the platform notification handler
+   * device_arrival->notify();
+   * @examples_end
+   */
+  class ManualSchedulerEventSource final: public SchedulerEventSource {
+  public:
+    [[nodiscard]] std::unique_ptr<Subscription>
+    subscribe(std::function<void()> callback) override;
+
+    /**
+     * @brief Invoke all the registered callbacks.
+     */
+    void
+    notify();
+
+  private:
+    class ManualSubscription;
+
+    std::mutex m_mutex; /**< Guards the callbacks (held while invoking them, so that they cannot be removed in the meantime). */
+    std::map<std::uint64_t, std::function<void()>> m_callbacks;
+    std::uint64_t m_next_id { 0 };
+  };
+}  // namespace display_device
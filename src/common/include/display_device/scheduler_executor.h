@@ -0,0 +1,234 @@
+/**
+ * @file src/common/include/display_device/scheduler_executor.h
+ * @brief Declarations for the SchedulerExecutor.
+ */
+#pragma once
+
+// system includes
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace display_device {
+  /**
+   * @brief A shared executor for the timers of many RetryScheduler instances.
+   *
+   * The timers are kept in a hashed timer wheel that is advanced by a single thread and
+   * the expired timer callbacks are executed by a small pool of worker threads.
+   * A callback of the same timer is never executed concurrently with itself.
+   *
+   * @examples
+   * const auto executor { std::make_shared<SchedulerExecutor>() };
+   * RetryScheduler<SettingsManagerInterface> scheduler_a { std::make_unique<SettingsManager>(...), executor };
+   * RetryScheduler<SettingsManagerInterface> scheduler_b { std::make_unique<SettingsManager>(...), executor };
+   * @examples_end
+   */
+  class SchedulerExecutor final {
+  public:
+    using Clock = std::chrono::steady_clock; /**< Clock used for the timer deadlines. */
+
+    /**
+     * @brief Options for the executor.
+     */
+    struct Options {
+      std::size_t m_thread_count { 2 };  ///< Number of the worker threads executing the timer callbacks.
+      std::chrono::milliseconds m_tick_duration { 1 };  ///< Resolution of the timer wheel (the timers never expire earlier than requested).
+      std::size_t m_wheel_size { 512 };  ///< Number of the timer wheel buckets.
+    };
+
+    /**
+     * @brief A timer that executes the callback on the executor's worker thread once the deadline is reached.
+     * @note The timer must be destroyed before the executor.
+     */
+    class Timer final {
+    public:
+      /**
+       * @brief Unregister the timer.
+       * @note If the callback is running on another thread, the destructor waits until it is finished.
+       */
+      ~Timer();
+
+      /**
+       * @brief Deleted copy constructor.
+       */
+      Timer(const Timer &) = delete;
+
+      /**
+       * @brief Deleted copy operator.
+       */
+      Timer &
+      operator=(const Timer &) = delete;
+
+      /**
+       * @brief Arm the timer (replaces the previous deadline, if any).
+       * @param deadline Time point at which the callback is to be executed.
+       */
+      void
+      arm(Clock::time_point deadline);
+
+      /**
+       * @brief Disarm the timer. The callback will not be executed anymore, unless it is already running.
+       */
+      void
+      disarm();
+
+    private:
+      friend class SchedulerExecutor;
+
+      /**
+       * @brief Constructor used by the executor.
+       * @param executor Executor that owns the timer data.
+       * @param id Id of the timer in the executor.
+       */
+      explicit Timer(SchedulerExecutor &executor, std::uint64_t id);
+
+      SchedulerExecutor &m_executor;
+      std::uint64_t m_id;
+    };
+
+    /**
+     * @brief Constructor with the default options.
+     */
+    SchedulerExecutor();
+
+    /**
+     * @brief Default constructor.
+     * @param options Options for the executor. Throws on zero thread count, tick duration or wheel size.
+     */
+    explicit SchedulerExecutor(const Options &options);
+
+    /**
+     * @brief Stop and join all the threads.
+     */
+    ~SchedulerExecutor();
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    SchedulerExecutor(const SchedulerExecutor &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    SchedulerExecutor &
+    operator=(const SchedulerExecutor &) = delete;
+
+    /**
+     * @brief Create a new (disarmed) timer.
+     * @param callback Callback to be executed whenever the timer expires.
+     * @returns The timer.
+     */
+    [[nodiscard]] std::unique_ptr<Timer>
+    createTimer(std::function<void()> callback);
+
+  private:
+    /**
+     * @brief Data of a single timer.
+     */
+    struct Entry {
+      std::function<void()> m_callback;
+      bool m_armed { false };
+      std::uint64_t m_arm_sequence { 0 }; /**< Incremented on every arm/disarm to invalidate the stale wheel items. */
+      bool m_running { false };
+      bool m_erase_after_run { false }; /**< Set when the timer is destroyed from its own callback. */
+    };
+
+    /**
+     * @brief A reference to the armed timer in the wheel bucket.
+     */
+    struct WheelItem {
+      std::uint64_t m_id;
+      std::uint64_t m_arm_sequence;
+      std::uint64_t m_tick; /**< Absolute tick at which the timer expires. */
+    };
+
+    /**
+     * @brief Arm the timer.
+     * @see Timer::arm
+     */
+    void
+    arm(std::uint64_t id, Clock::time_point deadline);
+
+    /**
+     * @brief Disarm the timer.
+     * @see Timer::disarm
+     */
+    void
+    disarm(std::uint64_t id);
+
+    /**
+     * @brief Remove the timer (waits for the running callback unless called from it).
+     * @param id Id of the timer.
+     */
+    void
+    destroy(std::uint64_t id);
+
+    /**
+     * @brief Disarm the timer and invalidate all of its pending items.
+     * @param entry Timer data.
+     */
+    void
+    disarmUnlocked(Entry &entry);
+
+    /**
+     * @brief Get the tick that the time point belongs to (rounded down).
+     * @param time_point Time point to convert.
+     * @returns The absolute tick.
+     */
+    [[nodiscard]] std::uint64_t
+    getTick(Clock::time_point time_point) const;
+
+    /**
+     * @brief Pass the timers expired at the tick to the worker threads.
+     * @param tick The absolute tick.
+     */
+    void
+    processTickUnlocked(std::uint64_t tick);
+
+    /**
+     * @brief Find the earliest tick at which any of the armed timers expires.
+     * @returns The absolute tick (or the maximum value if no timer is armed).
+     */
+    [[nodiscard]] std::uint64_t
+    findNextArmedTickUnlocked() const;
+
+    /**
+     * @brief Main loop of the thread advancing the wheel.
+     */
+    void
+    runTicker();
+
+    /**
+     * @brief Main loop of the worker thread.
+     */
+    void
+    runWorker();
+
+    Options m_options;
+    Clock::time_point m_start { Clock::now() }; /**< Time point of the tick 0. */
+    std::mutex m_mutex;
+    std::condition_variable m_ticker_cv;
+    std::condition_variable m_worker_cv;
+    std::condition_variable m_done_cv; /**< Notified whenever some callback finishes running. */
+    std::unordered_map<std::uint64_t, Entry> m_entries;
+    std::vector<std::vector<WheelItem>> m_wheel;
+    std::uint64_t m_processed_tick { 0 }; /**< The last tick that was processed by the ticker. */
+    std::uint64_t m_next_armed_tick { std::numeric_limits<std::uint64_t>::max() }; /**< The ticker sleeps until this tick (never later than the earliest armed timer). */
+    std::size_t m_armed_count { 0 };
+    std::deque<std::pair<std::uint64_t, std::uint64_t>> m_ready; /**< Expired timers (id + arm sequence) waiting for a worker. */
+    std::uint64_t m_next_id { 0 };
+    bool m_stop { false };
+
+    // Always the last in the list so that all the members are already initialized!
+    std::vector<std::thread> m_workers;
+    std::thread m_ticker;
+  };
+}  // namespace display_device
@@ -0,0 +1,143 @@
+/**
+ * @file src/common/include/display_device/scheduler_metrics.h
+ * @brief Declarations for the RetryScheduler metrics.
+ */
+#pragma once
+
+// system includes
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace display_device {
+  /**
+   * @brief A lock-free latency histogram with the power-of-two microsecond buckets.
+   *
+   * The bucket 0 counts the values below 1 microsecond, the bucket `i` counts the values
+   * in the `[2^(i-1), 2^i)` microsecond range and the last bucket also counts everything above it.
+   */
+  class LatencyHistogram final {
+  public:
+    static constexpr std::size_t m_bucket_count { 32 }; /**< Number of the buckets (the last one covers ~18 minutes and above). */
+
+    /**
+     * @brief A copy of the histogram data.
+     */
+    struct Snapshot {
+      std::array<std::uint64_t, m_bucket_count> m_buckets {};  ///< Number of the values in each bucket.
+      std::uint64_t m_count { 0 };  ///< Total number of the values.
+      std::chrono::microseconds m_total { 0 };  ///< Sum of all the values.
+      std::chrono::microseconds m_max { 0 };  ///< The largest value.
+
+      /**
+       * @brief Get the (exclusive) upper bound of the bucket.
+       * @param index Index of the bucket.
+       * @returns The upper bound or `std::chrono::microseconds::max()` for the last bucket.
+       */
+      [[nodiscard]] static std::chrono::microseconds
+      getUpperBound(std::size_t index);
+
+      /**
+       * @brief Get the approximate percentile (the upper bound of the bucket containing it).
+       * @param percentile Percentile in the [0, 100] range.
+       * @returns The approximate value or 0 if the histogram is empty.
+       */
+      [[nodiscard]] std::chrono::microseconds
+      getPercentile(double percentile) const;
+    };
+
+    /**
+     * @brief Record the value.
+     * @param value Value to record (negative values are recorded as 0).
+     */
+    void
+    record(std::chrono::steady_clock::duration value);
+
+    /**
+     * @brief Get the copy of the histogram data.
+     * @returns The snapshot.
+     * @note Values recorded concurrently may or may not be included.
+     */
+    [[nodiscard]] Snapshot
+    getSnapshot() const;
+
+  private:
+    std::array<std::atomic<std::uint64_t>, m_bucket_count> m_buckets {};
+    std::atomic<std::uint64_t> m_count { 0 };
+    std::atomic<std::uint64_t> m_total_us { 0 };
+    std::atomic<std::uint64_t> m_max_us { 0 };
+  };
+
+  /**
+   * @brief A copy of the RetryScheduler metrics.
+   */
+  struct SchedulerMetricsSnapshot {
+    std::uint64_t m_attempts { 0 };  ///< Number of the scheduled function executions (including the immediate ones).
+    std::uint64_t m_successes { 0 };  ///< Number of the scheduled function executions that requested the stop.
+    std::uint64_t m_exceptions { 0 };  ///< Number of the scheduled function executions that have thrown.
+    std::uint64_t m_exhausted { 0 };  ///< Number of the scheduled functions that have run out of attempts or time.
+    LatencyHistogram::Snapshot m_lock_wait;  ///< Time the `execute` (and similar) callers waited for the interface mutex.
+    LatencyHistogram::Snapshot m_callback_duration;  ///< Time the scheduled function has been running (holding the interface mutex).
+    LatencyHistogram::Snapshot m_first_run_delay;  ///< Time from scheduling the function until its first execution.
+  };
+
+  /**
+   * @brief Lock-free metrics of the RetryScheduler.
+   */
+  class SchedulerMetrics final {
+  public:
+    /**
+     * @brief Result of the scheduled function execution.
+     */
+    enum class Outcome {
+      Retry,  ///< Function will be retried.
+      Success,  ///< Function has requested the stop.
+      Exception  ///< Function has thrown.
+    };
+
+    /**
+     * @brief Record the scheduled function execution.
+     * @param outcome Result of the execution.
+     * @param duration Duration of the execution.
+     */
+    void
+    recordAttempt(Outcome outcome, std::chrono::steady_clock::duration duration);
+
+    /**
+     * @brief Record the scheduled function that has run out of attempts or time.
+     */
+    void
+    recordExhausted();
+
+    /**
+     * @brief Record the time spent waiting for the interface mutex.
+     * @param duration The waiting time.
+     */
+    void
+    recordLockWait(std::chrono::steady_clock::duration duration);
+
+    /**
+     * @brief Record the time from scheduling the function until its first execution.
+     * @param duration The delay.
+     */
+    void
+    recordFirstRunDelay(std::chrono::steady_clock::duration duration);
+
+    /**
+     * @brief Get the copy of the metrics.
+     * @returns The snapshot.
+     */
+    [[nodiscard]] SchedulerMetricsSnapshot
+    getSnapshot() const;
+
+  private:
+    std::atomic<std::uint64_t> m_attempts { 0 };
+    std::atomic<std::uint64_t> m_successes { 0 };
+    std::atomic<std::uint64_t> m_exceptions { 0 };
+    std::atomic<std::uint64_t> m_exhausted { 0 };
+    LatencyHistogram m_lock_wait;
+    LatencyHistogram m_callback_duration;
+    LatencyHistogram m_first_run_delay;
+  };
+}  // namespace display_device
@@ -10,10 +10,17 @@
 #include "display_device/logging.h"
 
 // system includes
-#include <chrono>
-#include <iomanip>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cstdio>
+#include <ctime>
 #include <iostream>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace display_device {
   namespace {
@@ -30,8 +37,473 @@ namespace display_device {
       }
       return {};
     }
+
+    /**
+     * @brief Set to true for the background thread of the asynchronous sink.
+     *
+     * Records produced by the background thread itself (e.g. from within the custom callback)
+     * are written synchronously to avoid deadlocking on a full queue.
+     */
+    thread_local bool is_async_sink_thread { false };
+
+    /**
+     * @brief Buffers that are reused by all the log statements of the same thread.
+     */
+    struct ThreadBuffers {
+      LogRecord m_record; /**< Record for the LogWriter. */
+      bool m_record_in_use { false }; /**< Set while the LogWriter is using the record. */
+      std::string m_output; /**< Buffer for the formatted prefix + value. */
+      bool m_output_in_use { false }; /**< Set while the output buffer is being used. */
+    };
+
+    ThreadBuffers &
+    getThreadBuffers() {
+      thread_local ThreadBuffers buffers;
+      return buffers;
+    }
+
+    /**
+     * @brief Provides the cleared thread-local output buffer for the duration of the scope.
+     *
+     * If the thread-local buffer is already in use (re-entrant logging from the custom callback),
+     * a temporary buffer is provided instead.
+     */
+    class OutputBuffer {
+    public:
+      OutputBuffer():
+          m_buffers { getThreadBuffers() },
+          m_is_owner { !m_buffers.m_output_in_use } {
+        m_buffers.m_output_in_use = true;
+        get().clear();
+      }
+
+      ~OutputBuffer() {
+        if (m_is_owner) {
+          m_buffers.m_output_in_use = false;
+        }
+      }
+
+      OutputBuffer(const OutputBuffer &) = delete;
+      OutputBuffer &
+      operator=(const OutputBuffer &) = delete;
+
+      std::string &
+      get() {
+        return m_is_owner ? m_buffers.m_output : m_nested_output;
+      }
+
+    private:
+      ThreadBuffers &m_buffers;
+      bool m_is_owner;
+      std::string m_nested_output;
+    };
+
+    std::string_view
+    getLogLevelPrefix(const Logger::LogLevel log_level) {
+      switch (log_level) {  // GCOVR_EXCL_BR_LINE for when there is no case match...
+        case Logger::LogLevel::verbose:
+          return "VERBOSE: ";
+        case Logger::LogLevel::debug:
+          return "DEBUG:   ";
+        case Logger::LogLevel::info:
+          return "INFO:    ";
+        case Logger::LogLevel::warning:
+          return "WARNING: ";
+        case Logger::LogLevel::error:
+          return "ERROR:   ";
+        case Logger::LogLevel::fatal:
+          return "FATAL:   ";
+      }
+      return {};
+    }
   }  // namespace
 
+  namespace detail {
+    void
+    appendLogTimestamp(std::string &output, const std::chrono::system_clock::time_point timestamp) {
+      struct Cache {
+        std::chrono::seconds m_seconds { std::chrono::seconds::min() };
+        std::array<char, 64> m_prefix {};
+        std::size_t m_size { 0 };
+      };
+      thread_local Cache cache;
+
+      const auto now_ms { std::chrono::duration_cast<std::chrono::milliseconds>(timestamp.time_since_epoch()) };
+      const auto now_s { std::chrono::floor<std::chrono::seconds>(now_ms) };
+      if (now_s != cache.m_seconds) {
+        const std::time_t time { std::chrono::system_clock::to_time_t(std::chrono::system_clock::time_point { now_s }) };
+        const auto localtime { threadSafeLocaltime(time) };
+
+        cache.m_seconds = now_s;
+        cache.m_size = std::strftime(cache.m_prefix.data(), cache.m_prefix.size(), "[%Y-%m-%d %H:%M:%S.", &localtime);
+      }
+
+      const auto now_decimal_part { static_cast<int>((now_ms - now_s).count()) };
+      output.append(cache.m_prefix.data(), cache.m_size);
+      output += static_cast<char>('0' + now_decimal_part / 100);
+      output += static_cast<char>('0' + now_decimal_part / 10 % 10);
+      output += static_cast<char>('0' + now_decimal_part % 10);
+      output += "] ";
+    }
+
+    void
+    appendLogLine(std::string &output, const LogRecord &record) {
+      appendLogTimestamp(output, record.getTimestamp());
+      output += getLogLevelPrefix(record.getLogLevel());
+      record.format(output);
+    }
+  }  // namespace detail
+
+  /**
+   * @brief Background sink used in the asynchronous logging mode.
+   *
+   * Records are pushed into a bounded multi-producer single-consumer ring buffer
+   * (https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue)
+   * and are written out by the background thread.
+   */
+  class Logger::AsyncSink {
+  public:
+    explicit AsyncSink(Logger &logger, const AsyncOptions &options):
+        m_logger { logger },
+        m_overflow_policy { options.m_overflow_policy },
+        m_slots(std::bit_ceil(std::max<std::size_t>(options.m_capacity, 2))),
+        m_mask { m_slots.size() - 1 } {
+      for (std::size_t i = 0; i < m_slots.size(); ++i) {
+        m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+      }
+
+      m_thread = std::thread { [this]() { run(); } };
+    }
+
+    ~AsyncSink() {
+      m_stop_requested.store(true, std::memory_order_release);
+      m_pushed.fetch_add(1, std::memory_order_release);
+      m_pushed.notify_one();
+      m_thread.join();
+    }
+
+    AsyncSink(const AsyncSink &) = delete;
+    AsyncSink &
+    operator=(const AsyncSink &) = delete;
+
+    void
+    push(LogRecord &record) {
+      if (!tryPush(record)) {
+        switch (m_overflow_policy) {
+          case OverflowPolicy::Drop:
+            return;
+          case OverflowPolicy::CountAndDrop:
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+          case OverflowPolicy::Block:
+            while (true) {
+              // The consumer always increments the counter after it frees a slot,
+              // so we either see a new value here or the retry succeeds.
+              const auto processed { m_processed.load(std::memory_order_acquire) };
+              if (tryPush(record)) {
+                break;
+              }
+              m_processed.wait(processed, std::memory_order_acquire);
+            }
+            break;
+        }
+      }
+
+      m_pushed.fetch_add(1, std::memory_order_release);
+      m_pushed.notify_one();
+    }
+
+    void
+    flush() {
+      if (is_async_sink_thread) {
+        return;
+      }
+
+      // Every record pushed before this call (by any thread) has reserved a position below the tail.
+      // The consumer pops the positions in order, so once it has processed this many records, all of them
+      // are written, even those whose producers have not yet published the slot at this point.
+      const std::uint64_t target { m_tail.load(std::memory_order_relaxed) };
+      auto processed { m_processed.load(std::memory_order_acquire) };
+      while (processed < target) {
+        m_processed.wait(processed, std::memory_order_acquire);
+        processed = m_processed.load(std::memory_order_acquire);
+      }
+    }
+
+  private:
+    struct Slot {
+      std::atomic<std::size_t> m_sequence;
+      LogRecord m_record;
+    };
+
+    /**
+     * @brief Try to push the record into the queue.
+     * @param record Record to be pushed. On success, it is swapped with the previous
+     *               slot content so that the allocated memory can be reused.
+     * @returns True if the record was pushed, false if the queue is full.
+     */
+    bool
+    tryPush(LogRecord &record) {
+      auto pos { m_tail.load(std::memory_order_relaxed) };
+      while (true) {
+        auto &slot { m_slots[pos & m_mask] };
+        const auto sequence { slot.m_sequence.load(std::memory_order_acquire) };
+        const auto diff { static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos) };
+        if (diff == 0) {
+          if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+            std::swap(slot.m_record, record);
+            slot.m_sequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (diff < 0) {
+          // Queue is full
+          return false;
+        }
+        else {
+          pos = m_tail.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    bool
+    tryPop(LogRecord &record) {
+      auto &slot { m_slots[m_head & m_mask] };
+      if (slot.m_sequence.load(std::memory_order_acquire) != m_head + 1) {
+        return false;
+      }
+
+      std::swap(record, slot.m_record);
+      slot.m_sequence.store(m_head + m_slots.size(), std::memory_order_release);
+      ++m_head;
+      return true;
+    }
+
+    void
+    reportDropped() {
+      if (const auto dropped { m_dropped.exchange(0, std::memory_order_relaxed) }; dropped > 0) {
+        LogRecord record { LogLevel::warning };
+        record.m_timestamp = std::chrono::system_clock::now();
+        record.append(dropped);
+        record.append(" log record(s) were dropped due to the full asynchronous log queue!");
+        m_logger.writeToSink(record);
+      }
+    }
+
+    void
+    run() {
+      is_async_sink_thread = true;
+
+      LogRecord record;
+      while (true) {
+        const auto pushed { m_pushed.load(std::memory_order_acquire) };
+        while (tryPop(record)) {
+          try {
+            m_logger.writeToSink(record);
+          }
+          catch (...) {
+            // There is no one to propagate the exception to and we must not die here.
+          }
+
+          m_processed.fetch_add(1, std::memory_order_release);
+          m_processed.notify_all();
+        }
+
+        reportDropped();
+        if (m_stop_requested.load(std::memory_order_acquire)) {
+          // All the producers have stopped by now, so the queue is drained.
+          break;
+        }
+
+        m_pushed.wait(pushed, std::memory_order_acquire);
+      }
+    }
+
+    Logger &m_logger;
+    OverflowPolicy m_overflow_policy;
+    std::vector<Slot> m_slots;
+    std::size_t m_mask;
+    std::size_t m_head { 0 }; /**< Only accessed by the consumer thread. */
+    alignas(64) std::atomic<std::size_t> m_tail { 0 };
+    alignas(64) std::atomic<std::uint64_t> m_pushed { 0 }; /**< Only used for waking up the consumer (the flush target is taken from the tail). */
+    alignas(64) std::atomic<std::uint64_t> m_processed { 0 };
+    std::atomic<std::uint64_t> m_dropped { 0 };
+    std::atomic<bool> m_stop_requested { false };
+    std::thread m_thread;
+  };
+
+  /**
+   * @brief Fixed-size lock-free ring of the most recent records that were not written out.
+   *
+   * Each slot is protected by a sequence lock, so that the writers never wait and the
+   * dump can detect (and skip) the slots that are being overwritten at the same time.
+   * The record data is copied into a preallocated buffer and is truncated if it does not fit.
+   */
+  class Logger::FlightRecorder {
+  public:
+    explicit FlightRecorder(const FlightRecorderOptions &options):
+        m_capture_level { options.m_capture_level },
+        m_dump_on_error { options.m_dump_on_error },
+        m_record_size { std::max<std::size_t>(options.m_record_size, 16) },
+        m_slots(std::bit_ceil(std::max<std::size_t>(options.m_capacity, 2))),
+        m_mask { m_slots.size() - 1 },
+        m_data(m_slots.size() * m_record_size) {
+    }
+
+    [[nodiscard]] LogLevel
+    getCaptureLevel() const {
+      return m_capture_level;
+    }
+
+    [[nodiscard]] bool
+    isDumpOnErrorEnabled() const {
+      return m_dump_on_error;
+    }
+
+    void
+    capture(const LogRecord &record) {
+      const auto ticket { m_next_ticket.fetch_add(1, std::memory_order_relaxed) + 1 };
+      auto &slot { m_slots[ticket & m_mask] };
+      auto sequence { slot.m_sequence.load(std::memory_order_relaxed) };
+      if ((sequence & 1) != 0 || !slot.m_sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed)) {
+        // Another writer is still busy with this slot (the ring has wrapped around), the record is dropped.
+        return;
+      }
+      std::atomic_thread_fence(std::memory_order_release);
+
+      char *const data { m_data.data() + (ticket & m_mask) * m_record_size };
+      const auto size { copyTruncated(record, data) };
+      slot.m_ticket = ticket;
+      slot.m_log_level = record.m_log_level;
+      slot.m_channel = record.m_channel;
+      slot.m_timestamp = record.m_timestamp;
+      slot.m_size = size;
+      slot.m_truncated = size < record.m_data.size();
+
+      slot.m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Collect the records that have not been dumped yet.
+     * @returns Records sorted from the oldest to the newest.
+     */
+    [[nodiscard]] std::vector<LogRecord>
+    takeRecords() {
+      std::lock_guard lock { m_dump_mutex };
+
+      std::vector<std::pair<std::uint64_t, LogRecord>> entries;
+      std::vector<char> buffer(m_record_size);
+      for (std::size_t i = 0; i < m_slots.size(); ++i) {
+        const auto &slot { m_slots[i] };
+        const auto sequence { slot.m_sequence.load(std::memory_order_acquire) };
+        if (sequence == 0 || (sequence & 1) != 0) {
+          continue;
+        }
+
+        const auto ticket { slot.m_ticket };
+        LogRecord record { slot.m_log_level, slot.m_channel };
+        record.m_timestamp = slot.m_timestamp;
+        const auto size { std::min(slot.m_size, m_record_size) };
+        const bool truncated { slot.m_truncated };
+        std::memcpy(buffer.data(), m_data.data() + i * m_record_size, size);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.m_sequence.load(std::memory_order_relaxed) != sequence || ticket <= m_dumped_ticket) {
+          continue;
+        }
+
+        record.m_data.assign(buffer.data(), buffer.data() + size);
+        if (truncated) {
+          record.append(" [truncated]");
+        }
+        entries.emplace_back(ticket, std::move(record));
+      }
+
+      std::ranges::sort(entries, {}, &std::pair<std::uint64_t, LogRecord>::first);
+      if (!entries.empty()) {
+        m_dumped_ticket = entries.back().first;
+      }
+
+      std::vector<LogRecord> records;
+      records.reserve(entries.size());
+      for (auto &entry : entries) {
+        records.push_back(std::move(entry.second));
+      }
+      return records;
+    }
+
+  private:
+    struct Slot {
+      std::atomic<std::uint64_t> m_sequence { 0 }; /**< Odd while the slot is being written, 0 if it was never written. */
+      std::uint64_t m_ticket { 0 };
+      LogLevel m_log_level { LogLevel::verbose };
+      LogChannel m_channel { LogChannel::general };
+      std::chrono::system_clock::time_point m_timestamp {};
+      std::size_t m_size { 0 };
+      bool m_truncated { false };
+    };
+
+    /**
+     * @brief Copy as many of the record values as fit into the slot data.
+     * @param record Record to be copied.
+     * @param data Slot data of the `m_record_size` size.
+     * @returns Number of bytes copied.
+     * @note Only the last copied string value can be shortened, other values are never split.
+     */
+    [[nodiscard]] std::size_t
+    copyTruncated(const LogRecord &record, char *const data) const {
+      if (record.m_data.size() <= m_record_size) {
+        std::memcpy(data, record.m_data.data(), record.m_data.size());
+        return record.m_data.size();
+      }
+
+      std::size_t size { 0 };
+      bool is_full { false };
+      record.visitTyped([this, data, &size, &is_full](const LogRecord::ArgumentType type, const auto &value) {
+        using T = std::decay_t<decltype(value)>;
+        if (is_full) {
+          return;
+        }
+
+        if constexpr (std::is_same_v<T, std::string_view>) {
+          constexpr std::size_t header_size { 1 + sizeof(std::uint32_t) };
+          if (size + header_size >= m_record_size) {
+            is_full = true;
+            return;
+          }
+
+          const auto length { static_cast<std::uint32_t>(std::min(value.size(), m_record_size - size - header_size)) };
+          data[size] = static_cast<char>(type);
+          std::memcpy(data + size + 1, &length, sizeof(length));
+          std::memcpy(data + size + header_size, value.data(), length);
+          size += header_size + length;
+          is_full = length < value.size();
+        }
+        else {
+          if (size + 1 + sizeof(T) > m_record_size) {
+            is_full = true;
+            return;
+          }
+
+          data[size] = static_cast<char>(type);
+          std::memcpy(data + size + 1, &value, sizeof(T));
+          size += 1 + sizeof(T);
+        }
+      });
+      return size;
+    }
+
+    LogLevel m_capture_level;
+    bool m_dump_on_error;
+    std::size_t m_record_size;
+    std::vector<Slot> m_slots;
+    std::size_t m_mask;
+    std::vector<char> m_data; /**< Record data of all the slots. */
+    alignas(64) std::atomic<std::uint64_t> m_next_ticket { 0 };
+    std::mutex m_dump_mutex;
+    std::uint64_t m_dumped_ticket { 0 }; /**< Ticket of the last dumped record (guarded by the mutex). */
+  };
+
   Logger &
   Logger::get() {
     static Logger instance;  // GCOVR_EXCL_BR_LINE for some reason...
@@ -40,88 +512,247 @@ namespace display_device {
 
   void
   Logger::setLogLevel(const LogLevel log_level) {
-    m_enabled_log_level = log_level;
+    for (auto &channel_log_level : m_channel_log_levels) {
+      channel_log_level.m_log_level.store(log_level, std::memory_order_relaxed);
+    }
+    updateCaptureLevels();
   }
 
-  bool
-  Logger::isLogLevelEnabled(LogLevel log_level) const {
-    const auto log_level_v { static_cast<std::underlying_type_t<LogLevel>>(log_level) };
-    const auto enabled_log_level_v { static_cast<std::underlying_type_t<LogLevel>>(m_enabled_log_level) };
-    return log_level_v >= enabled_log_level_v;
+  void
+  Logger::setLogLevel(const LogChannel channel, const LogLevel log_level) {
+    m_channel_log_levels[static_cast<std::size_t>(channel)].m_log_level.store(log_level, std::memory_order_relaxed);
+    updateCaptureLevels();
   }
 
   void
   Logger::setCustomCallback(Callback callback) {
+    flush();
     m_custom_callback = std::move(callback);
+    m_custom_record_callback = nullptr;
   }
 
   void
-  Logger::write(const LogLevel log_level, std::string value) {
-    if (!isLogLevelEnabled(log_level)) {
+  Logger::setCustomRecordCallback(RecordCallback callback) {
+    flush();
+    m_custom_record_callback = std::move(callback);
+    m_custom_callback = nullptr;
+  }
+
+  void
+  Logger::write(const LogLevel log_level, const std::string_view value) {
+    if (!isLogLevelCaptured(LogChannel::general, log_level)) {
       return;
     }
 
-    if (m_custom_callback) {
-      m_custom_callback(log_level, std::move(value));
+    LogWriter { log_level } << value;
+  }
+
+  void
+  Logger::write(LogRecord &&record) {
+    if (!isLogLevelEnabled(record.m_channel, record.m_log_level)) {
+      if (m_flight_recorder && static_cast<int>(record.m_log_level) >= static_cast<int>(m_flight_recorder->getCaptureLevel())) {
+        record.m_timestamp = std::chrono::system_clock::now();
+        m_flight_recorder->capture(record);
+      }
       return;
     }
 
-    std::stringstream stream;
-    {
-      // Time (limited by GCC 10, so it's not pretty...)
-      {
-        const auto now { std::chrono::system_clock::now() };
-        const auto now_ms { std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) };
-        const auto now_s { std::chrono::duration_cast<std::chrono::seconds>(now_ms) };
+    record.m_timestamp = std::chrono::system_clock::now();
+    if (m_flight_recorder && m_flight_recorder->isDumpOnErrorEnabled() && static_cast<int>(record.m_log_level) >= static_cast<int>(LogLevel::error)) {
+      dumpFlightRecorder();
+    }
 
-        const std::time_t time { std::chrono::system_clock::to_time_t(now) };
-        const auto localtime { threadSafeLocaltime(time) };
-        const auto now_decimal_part { now_ms - now_s };
+    dispatch(record);
+  }
 
-        const auto old_flags { stream.flags() };  // Save formatting flags so that they can be restored...
-        stream << std::put_time(&localtime, "[%Y-%m-%d %H:%M:%S.") << std::setfill('0') << std::setw(3) << now_decimal_part.count() << "] ";
-        stream.flags(old_flags);
-      }
+  void
+  Logger::enableFlightRecorder(const FlightRecorderOptions &options) {
+    m_flight_recorder = std::make_unique<FlightRecorder>(options);
+    updateCaptureLevels();
+  }
 
-      // Log level
-      switch (log_level) {  // GCOVR_EXCL_BR_LINE for when there is no case match...
-        case LogLevel::verbose:
-          stream << "VERBOSE: ";
-          break;
-        case LogLevel::debug:
-          stream << "DEBUG:   ";
-          break;
-        case LogLevel::info:
-          stream << "INFO:    ";
-          break;
-        case LogLevel::warning:
-          stream << "WARNING: ";
-          break;
-        case LogLevel::error:
-          stream << "ERROR:   ";
-          break;
-        case LogLevel::fatal:
-          stream << "FATAL:   ";
-          break;
+  void
+  Logger::disableFlightRecorder() {
+    m_flight_recorder.reset();
+    updateCaptureLevels();
+  }
+
+  bool
+  Logger::isFlightRecorderEnabled() const {
+    return static_cast<bool>(m_flight_recorder);
+  }
+
+  void
+  Logger::dumpFlightRecorder() {
+    if (!m_flight_recorder) {
+      return;
+    }
+
+    auto records { m_flight_recorder->takeRecords() };
+    if (records.empty()) {
+      return;
+    }
+
+    LogRecord header { LogLevel::info };
+    header.m_timestamp = std::chrono::system_clock::now();
+    header.append("Flight recorder dump of ");
+    header.append(records.size());
+    header.append(" record(s) that were not written out:");
+    dispatch(header);
+
+    for (auto &record : records) {
+      dispatch(record);
+    }
+
+    LogRecord footer { LogLevel::info };
+    footer.m_timestamp = std::chrono::system_clock::now();
+    footer.append("End of the flight recorder dump.");
+    dispatch(footer);
+  }
+
+  void
+  Logger::enableAsync(const AsyncOptions &options) {
+    disableAsync();
+    m_async_sink = std::make_unique<AsyncSink>(*this, options);
+  }
+
+  void
+  Logger::disableAsync() {
+    m_async_sink.reset();
+  }
+
+  bool
+  Logger::isAsyncEnabled() const {
+    return static_cast<bool>(m_async_sink);
+  }
+
+  void
+  Logger::flush() {
+    if (m_async_sink) {
+      m_async_sink->flush();
+    }
+  }
+
+  void
+  Logger::dispatch(LogRecord &record) {
+    if (m_async_sink && !is_async_sink_thread) {
+      m_async_sink->push(record);
+      return;
+    }
+
+    writeToSink(record);
+  }
+
+  void
+  Logger::updateCaptureLevels() {
+    static std::mutex update_mutex;
+    std::lock_guard lock { update_mutex };
+
+    for (auto &channel_log_level : m_channel_log_levels) {
+      auto capture_level { channel_log_level.m_log_level.load(std::memory_order_relaxed) };
+      if (m_flight_recorder) {
+        capture_level = std::min(capture_level, m_flight_recorder->getCaptureLevel());
       }
+      channel_log_level.m_capture_level.store(capture_level, std::memory_order_relaxed);
+    }
+  }
+
+  void
+  Logger::writeToSink(const LogRecord &record) {
+    if (m_custom_record_callback) {
+      m_custom_record_callback(record);
+      return;
+    }
 
-      // Value
-      stream << value;
+    OutputBuffer buffer;
+    auto &output { buffer.get() };
+    if (m_custom_callback) {
+      record.format(output);
+      m_custom_callback(record.m_log_level, output);
+      return;
     }
 
+    detail::appendLogLine(output, record);
+
     static std::mutex log_mutex;
     std::lock_guard lock { log_mutex };
-    std::cout << stream.rdbuf() << std::endl;
+    std::cout.write(output.data(), static_cast<std::streamsize>(output.size())) << std::endl;
   }
 
-  Logger::Logger():
-      m_enabled_log_level { LogLevel::info } {
+  Logger::Logger() = default;
+
+  Logger::~Logger() {
+    disableAsync();
   }
 
-  LogWriter::LogWriter(const Logger::LogLevel log_level):
-      m_log_level { log_level } {}
+  LogWriter::LogWriter(const Logger::LogLevel log_level, const Logger::LogChannel channel) {
+    auto &buffers { getThreadBuffers() };
+    if (buffers.m_record_in_use) {
+      m_record = &m_nested_record.emplace(log_level, channel);
+      return;
+    }
+
+    buffers.m_record_in_use = true;
+    m_record = &buffers.m_record;
+    m_record->reset(log_level, channel);
+  }
 
   LogWriter::~LogWriter() {
-    Logger::get().write(m_log_level, m_buffer.str());
+    Logger::get().write(std::move(*m_record));
+    if (!m_nested_record) {
+      getThreadBuffers().m_record_in_use = false;
+    }
+  }
+
+  bool
+  LogDedupState::exchange(const std::uint64_t hash) {
+    return m_last_hash.exchange(hash, std::memory_order_relaxed) == hash;
   }
+
+  LogWriter &
+  LogWriter::operator<<(const LogDedupPayload &value) {
+    value.appendTo(*m_record);
+    return *this;
+  }
+
+  LogDedupPayload::LogDedupPayload(LogDedupState &state, const std::string_view payload):
+      m_state { &state },
+      m_payload { payload } {
+  }
+
+  void
+  LogDedupPayload::appendTo(LogRecord &record) const {
+    // The flight recorder only records, so the marker would refer to a payload that was never written out
+    if (!Logger::isLogLevelEnabled(record.getChannel(), record.getLogLevel())) {
+      record.append(m_payload);
+      return;
+    }
+
+    const auto hash { detail::hashLogPayload(m_payload) };
+    if (!m_state->exchange(hash)) {
+      record.append(m_payload);
+      return;
+    }
+
+    constexpr std::string_view prefix { "unchanged (hash=" };
+    std::array<char, 40> marker;
+    auto *it { std::copy(std::begin(prefix), std::end(prefix), marker.data()) };
+    it = std::to_chars(it, marker.data() + marker.size(), hash, 16).ptr;
+    *it++ = ')';
+    record.append(std::string_view { marker.data(), static_cast<std::size_t>(it - marker.data()) });
+  }
+
+  namespace detail {
+    std::uint64_t
+    hashLogPayload(const std::string_view payload) {
+      std::uint64_t hash { 14695981039346656037ull };
+      for (const char value : payload) {
+        hash ^= static_cast<unsigned char>(value);
+        hash *= 1099511628211ull;
+      }
+
+      // 0 is reserved for the "nothing was logged yet" state
+      return hash == 0 ? 1 : hash;
+    }
+  }  // namespace detail
 }  // namespace display_device
@@ -0,0 +1,262 @@
+/**
+ * @file src/common/logging_record.cpp
+ * @brief Definitions for the LogRecord.
+ */
+// class header include
+#include "display_device/logging.h"
+
+// system includes
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <optional>
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief Stream state that affects the formatting of the captured values.
+     */
+    struct FormatState {
+      std::ios_base::fmtflags m_flags { std::ios_base::dec | std::ios_base::skipws };
+      std::optional<std::ios> m_stream; /**< Lazily created for applying the manipulators. */
+
+      void
+      apply(const LogRecord::Manipulator &manipulator) {
+        if (!m_stream) {
+          m_stream.emplace(nullptr);
+        }
+
+        m_stream->flags(m_flags);
+        manipulator.m_function(*m_stream);
+        m_flags = m_stream->flags();
+      }
+
+      [[nodiscard]] bool
+      isSet(const std::ios_base::fmtflags flag) const {
+        return (m_flags & flag) != 0;
+      }
+
+      [[nodiscard]] int
+      getBase() const {
+        const auto base_flags { m_flags & std::ios_base::basefield };
+        if (base_flags == std::ios_base::hex) {
+          return 16;
+        }
+        if (base_flags == std::ios_base::oct) {
+          return 8;
+        }
+        return 10;
+      }
+    };
+
+    void
+    appendUppercase(std::string &output, const char *begin, const char *end) {
+      for (auto it { begin }; it != end; ++it) {
+        output.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(*it))));
+      }
+    }
+
+    void
+    appendUnsigned(std::string &output, const std::uint64_t value, const FormatState &state) {
+      const int base { state.getBase() };
+      if (value != 0 && state.isSet(std::ios_base::showbase)) {
+        if (base == 16) {
+          output += state.isSet(std::ios_base::uppercase) ? "0X" : "0x";
+        }
+        else if (base == 8) {
+          output += '0';
+        }
+      }
+
+      std::array<char, 64> buffer;
+      const auto result { std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base) };
+      if (base == 16 && state.isSet(std::ios_base::uppercase)) {
+        appendUppercase(output, buffer.data(), result.ptr);
+      }
+      else {
+        output.append(buffer.data(), result.ptr);
+      }
+    }
+
+    void
+    appendSigned(std::string &output, const std::int64_t value, const int bits, const FormatState &state) {
+      if (state.getBase() != 10) {
+        // Same as the std::ostream, the value is reinterpreted as unsigned of the original size
+        const auto mask { bits < 64 ? (std::uint64_t { 1 } << bits) - 1 : ~std::uint64_t { 0 } };
+        appendUnsigned(output, static_cast<std::uint64_t>(value) & mask, state);
+        return;
+      }
+
+      if (value >= 0 && state.isSet(std::ios_base::showpos)) {
+        output += '+';
+      }
+
+      std::array<char, 64> buffer;
+      const auto result { std::to_chars(buffer.data(), buffer.data() + buffer.size(), value) };
+      output.append(buffer.data(), result.ptr);
+    }
+
+    void
+    appendDouble(std::string &output, const double value, const FormatState &state) {
+      constexpr int precision { 6 };  // The default std::ostream precision
+
+      if (std::signbit(value)) {
+        output += '-';
+      }
+      else if (state.isSet(std::ios_base::showpos)) {
+        output += '+';
+      }
+
+      const auto float_flags { state.m_flags & std::ios_base::floatfield };
+      const auto abs_value { std::abs(value) };
+      std::array<char, 512> buffer;
+      std::to_chars_result result;
+      if (float_flags == std::ios_base::floatfield) {
+        // Same as the std::ostream (and "%a"), the hexfloat ignores the precision and is prefixed with "0x" (unless inf/nan)
+        if (std::isfinite(abs_value)) {
+          output += state.isSet(std::ios_base::uppercase) ? "0X" : "0x";
+        }
+        result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), abs_value, std::chars_format::hex);
+      }
+      else {
+        auto format { std::chars_format::general };
+        if (float_flags == std::ios_base::fixed) {
+          format = std::chars_format::fixed;
+        }
+        else if (float_flags == std::ios_base::scientific) {
+          format = std::chars_format::scientific;
+        }
+        result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), abs_value, format, precision);
+      }
+
+      if (state.isSet(std::ios_base::uppercase)) {
+        appendUppercase(output, buffer.data(), result.ptr);
+      }
+      else {
+        output.append(buffer.data(), result.ptr);
+      }
+    }
+
+    void
+    appendPointer(std::string &output, const void *value) {
+      if (!value) {
+        output += '0';
+        return;
+      }
+
+      std::array<char, 32> buffer;
+      const auto result { std::to_chars(buffer.data(), buffer.data() + buffer.size(), reinterpret_cast<std::uintptr_t>(value), 16) };
+      output += "0x";
+      output.append(buffer.data(), result.ptr);
+    }
+  }  // namespace
+
+  LogRecord::LogRecord(const Logger::LogLevel log_level, const Logger::LogChannel channel):
+      m_log_level { log_level },
+      m_channel { channel } {
+  }
+
+  Logger::LogLevel
+  LogRecord::getLogLevel() const {
+    return m_log_level;
+  }
+
+  Logger::LogChannel
+  LogRecord::getChannel() const {
+    return m_channel;
+  }
+
+  std::chrono::system_clock::time_point
+  LogRecord::getTimestamp() const {
+    return m_timestamp;
+  }
+
+  bool
+  LogRecord::empty() const {
+    return m_data.empty();
+  }
+
+  void
+  LogRecord::reset(const Logger::LogLevel log_level, const Logger::LogChannel channel) {
+    m_log_level = log_level;
+    m_channel = channel;
+    m_timestamp = {};
+    m_data.clear();
+    m_flags = std::ios_base::dec | std::ios_base::skipws;
+  }
+
+  void
+  LogRecord::format(std::string &output) const {
+    FormatState state;
+    visitTyped([&output, &state](const ArgumentType type, const auto &value) {
+      using T = std::decay_t<decltype(value)>;
+      if constexpr (std::is_same_v<T, bool>) {
+        if (state.isSet(std::ios_base::boolalpha)) {
+          output += value ? "true" : "false";
+        }
+        else {
+          // Same as the std::ostream, the numeric bool is written as a signed integer
+          appendSigned(output, value ? 1 : 0, 64, state);
+        }
+      }
+      else if constexpr (std::is_same_v<T, char>) {
+        output += value;
+      }
+      else if constexpr (std::is_same_v<T, std::int64_t>) {
+        const int bits { type == ArgumentType::SignedInteger16 ? 16 : (type == ArgumentType::SignedInteger32 ? 32 : 64) };
+        appendSigned(output, value, bits, state);
+      }
+      else if constexpr (std::is_same_v<T, std::uint64_t>) {
+        appendUnsigned(output, value, state);
+      }
+      else if constexpr (std::is_same_v<T, double>) {
+        appendDouble(output, value, state);
+      }
+      else if constexpr (std::is_same_v<T, std::string_view>) {
+        output += value;
+      }
+      else if constexpr (std::is_same_v<T, const void *>) {
+        appendPointer(output, value);
+      }
+      else {
+        state.apply(value);
+      }
+    });
+  }
+
+  std::string
+  LogRecord::toString() const {
+    std::string output;
+    format(output);
+    return output;
+  }
+
+  void
+  LogRecord::appendString(const std::string_view value) {
+    const auto size { static_cast<std::uint32_t>(value.size()) };
+    const auto pos { m_data.size() };
+    m_data.resize(pos + 1 + sizeof(size) + size);
+    m_data[pos] = static_cast<char>(ArgumentType::String);
+    std::memcpy(m_data.data() + pos + 1, &size, sizeof(size));
+    std::memcpy(m_data.data() + pos + 1 + sizeof(size), value.data(), size);
+  }
+
+  void
+  LogRecord::appendManipulator(const Manipulator manipulator) {
+    appendValue(ArgumentType::Manipulator, manipulator);
+
+    auto &stream { getFallbackStream(m_flags) };
+    manipulator.m_function(stream);
+    m_flags = stream.flags();
+  }
+
+  std::ostringstream &
+  LogRecord::getFallbackStream(const std::ios_base::fmtflags flags) {
+    thread_local std::ostringstream stream;
+    stream.str(std::string {});
+    stream.clear();
+    stream.flags(flags);
+    return stream;
+  }
+}  // namespace display_device
@@ -0,0 +1,341 @@
+/**
+ * @file src/common/mapped_file_log_sink.cpp
+ * @brief Definitions for the memory-mapped file log sink.
+ */
+// class header include
+#include "display_device/mapped_file_log_sink.h"
+
+// system includes
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#if defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+namespace display_device {
+  /**
+   * @brief A file of a fixed size that is mapped into the memory for writing.
+   */
+  class MappedFileLogSink::MappedFile {
+  public:
+    MappedFile(const std::filesystem::path &filepath, const std::size_t size):
+        m_size { size } {
+#if defined(_WIN32)
+      m_file = CreateFileW(filepath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (m_file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error { "Failed to create " + filepath.string() + " for MappedFileLogSink!" };
+      }
+
+      const auto size_64 { static_cast<std::uint64_t>(size) };
+      m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size_64 >> 32), static_cast<DWORD>(size_64 & 0xFFFFFFFF), nullptr);
+      if (!m_mapping) {
+        CloseHandle(m_file);
+        throw std::runtime_error { "Failed to map " + filepath.string() + " for MappedFileLogSink!" };
+      }
+
+      m_data = static_cast<char *>(MapViewOfFile(m_mapping, FILE_MAP_WRITE, 0, 0, size));
+      if (!m_data) {
+        CloseHandle(m_mapping);
+        CloseHandle(m_file);
+        throw std::runtime_error { "Failed to map " + filepath.string() + " for MappedFileLogSink!" };
+      }
+#else
+      m_file = ::open(filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+      if (m_file < 0) {
+        throw std::runtime_error { "Failed to create " + filepath.string() + " for MappedFileLogSink!" };
+      }
+
+      if (::ftruncate(m_file, static_cast<off_t>(size)) != 0) {
+        ::close(m_file);
+        throw std::runtime_error { "Failed to resize " + filepath.string() + " for MappedFileLogSink!" };
+      }
+
+      void *data { ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0) };
+      if (data == MAP_FAILED) {
+        ::close(m_file);
+        throw std::runtime_error { "Failed to map " + filepath.string() + " for MappedFileLogSink!" };
+      }
+      m_data = static_cast<char *>(data);
+#endif
+    }
+
+    /**
+     * @brief Unmap the file and truncate it to the used size (trailing zeros are not kept).
+     */
+    ~MappedFile() {
+      while (m_used_size > 0 && m_data[m_used_size - 1] == '\0') {
+        --m_used_size;
+      }
+
+#if defined(_WIN32)
+      UnmapViewOfFile(m_data);
+      CloseHandle(m_mapping);
+
+      LARGE_INTEGER position;
+      position.QuadPart = static_cast<LONGLONG>(m_used_size);
+      if (SetFilePointerEx(m_file, position, nullptr, FILE_BEGIN)) {
+        SetEndOfFile(m_file);
+      }
+      CloseHandle(m_file);
+#else
+      ::munmap(m_data, m_size);
+      static_cast<void>(::ftruncate(m_file, static_cast<off_t>(m_used_size)));
+      ::close(m_file);
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &
+    operator=(const MappedFile &) = delete;
+
+    [[nodiscard]] char *
+    data() {
+      return m_data;
+    }
+
+    /**
+     * @brief Set the size up to which the data may have been written.
+     * @param size The used size.
+     */
+    void
+    setUsedSize(const std::size_t size) {
+      m_used_size = std::min(size, m_size);
+    }
+
+  private:
+    std::size_t m_size;
+    std::size_t m_used_size { m_size };
+    char *m_data { nullptr };
+#if defined(_WIN32)
+    HANDLE m_file { INVALID_HANDLE_VALUE };
+    HANDLE m_mapping { nullptr };
+#else
+    int m_file { -1 };
+#endif
+  };
+
+  namespace {
+    /**
+     * @brief Parse the segment number from the filename.
+     * @param filename Filename to parse.
+     * @param stem Expected stem of the filename (including the trailing dot).
+     * @param extension Expected extension of the filename.
+     * @returns The segment number or empty optional if the filename does not match.
+     */
+    std::optional<std::uint64_t>
+    parseSegmentNumber(const std::string &filename, const std::string &stem, const std::string &extension) {
+      if (filename.size() <= stem.size() + extension.size() || !filename.starts_with(stem) || !filename.ends_with(extension)) {
+        return std::nullopt;
+      }
+
+      const auto number { std::string_view { filename }.substr(stem.size(), filename.size() - stem.size() - extension.size()) };
+      if (!std::ranges::all_of(number, [](const char value) { return value >= '0' && value <= '9'; })) {
+        return std::nullopt;
+      }
+
+      std::uint64_t result { 0 };
+      for (const char value : number) {
+        result = result * 10 + static_cast<std::uint64_t>(value - '0');
+      }
+      return result;
+    }
+  }  // namespace
+
+  MappedFileLogSink::MappedFileLogSink(Options options):
+      m_options { std::move(options) } {
+    if (m_options.m_filepath.empty()) {
+      throw std::runtime_error { "Empty filename provided for MappedFileLogSink!" };
+    }
+    if (m_options.m_segment_size == 0 || m_options.m_max_segments == 0) {
+      throw std::runtime_error { "Segment size and count must be larger than 0 for MappedFileLogSink!" };
+    }
+
+    // Continue the numbering after the segments from the previous runs
+    const auto directory { m_options.m_filepath.has_parent_path() ? m_options.m_filepath.parent_path() : std::filesystem::path { "." } };
+    const auto stem { m_options.m_filepath.stem().string() + "." };
+    const auto extension { m_options.m_filepath.extension().string() };
+    std::vector<std::uint64_t> existing_segments;
+    std::error_code error_code;
+    for (const auto &entry : std::filesystem::directory_iterator { directory, error_code }) {
+      if (const auto number { parseSegmentNumber(entry.path().filename().string(), stem, extension) }) {
+        existing_segments.push_back(*number);
+      }
+    }
+
+    if (!existing_segments.empty()) {
+      m_segment_number = std::ranges::max(existing_segments) + 1;
+      for (const auto number : existing_segments) {
+        if (number + m_options.m_max_segments <= m_segment_number) {
+          std::filesystem::remove(getSegmentPath(number), error_code);
+        }
+      }
+    }
+
+    m_file = std::make_unique<MappedFile>(getSegmentPath(m_segment_number), m_options.m_segment_size);
+    m_next_segment_number = m_segment_number + 1;
+    m_background_thread = std::thread { [this]() { runBackground(); } };
+  }
+
+  MappedFileLogSink::~MappedFileLogSink() {
+    {
+      std::lock_guard lock { m_background_mutex };
+      m_stop = true;
+    }
+    m_background_cv.notify_all();
+    m_background_thread.join();
+
+    if (m_file) {
+      m_file->setUsedSize(m_offset.load(std::memory_order_relaxed));
+    }
+
+    if (m_next_file_ready) {
+      m_next_file.reset();
+      std::error_code error_code;
+      std::filesystem::remove(getSegmentPath(m_next_segment_number), error_code);
+    }
+  }
+
+  void
+  MappedFileLogSink::write(const LogRecord &record) {
+    thread_local std::string output;
+    output.clear();
+    detail::appendLogLine(output, record);
+    output += '\n';
+    write(output);
+  }
+
+  void
+  MappedFileLogSink::write(std::string_view data) {
+    data = data.substr(0, m_options.m_segment_size);
+    if (data.empty()) {
+      return;
+    }
+
+    while (true) {
+      std::uint64_t full_segment_number;
+      {
+        std::shared_lock lock { m_mutex };
+        full_segment_number = m_segment_number;
+        if (m_file) {
+          const auto offset { m_offset.fetch_add(data.size(), std::memory_order_relaxed) };
+          if (offset + data.size() <= m_options.m_segment_size) {
+            std::memcpy(m_file->data() + offset, data.data(), data.size());
+            return;
+          }
+        }
+      }
+
+      rotate(full_segment_number);
+      if (std::shared_lock lock { m_mutex }; !m_file) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    }
+  }
+
+  std::filesystem::path
+  MappedFileLogSink::getCurrentSegmentPath() const {
+    std::shared_lock lock { m_mutex };
+    return getSegmentPath(m_segment_number);
+  }
+
+  std::uint64_t
+  MappedFileLogSink::getDroppedCount() const {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  std::filesystem::path
+  MappedFileLogSink::getSegmentPath(const std::uint64_t number) const {
+    auto filepath { m_options.m_filepath };
+    filepath.replace_filename(m_options.m_filepath.stem().string() + "." + std::to_string(number) + m_options.m_filepath.extension().string());
+    return filepath;
+  }
+
+  void
+  MappedFileLogSink::rotate(const std::uint64_t full_segment_number) {
+    std::unique_lock lock { m_mutex };
+    if (m_segment_number != full_segment_number && m_file) {
+      // Some other writer has already rotated the segment
+      return;
+    }
+
+    openNextSegmentUnlocked();
+  }
+
+  void
+  MappedFileLogSink::openNextSegmentUnlocked() {
+    {
+      std::unique_lock lock { m_background_mutex };
+      m_background_cv.wait(lock, [this]() { return m_next_file_ready; });
+
+      // Unmapping and truncating the full segment is left for the background thread
+      if (m_file) {
+        m_file->setUsedSize(m_offset.load(std::memory_order_relaxed));
+        m_full_files.push_back(std::move(m_file));
+      }
+
+      m_segment_number = m_next_segment_number++;
+      m_offset.store(0, std::memory_order_relaxed);
+      m_file = std::move(m_next_file);
+      m_next_file_ready = false;
+      if (m_segment_number >= m_options.m_max_segments) {
+        m_expired_segments.push_back(m_segment_number - m_options.m_max_segments);
+      }
+    }
+
+    m_background_cv.notify_all();
+  }
+
+  void
+  MappedFileLogSink::runBackground() {
+    std::unique_lock lock { m_background_mutex };
+    while (true) {
+      m_background_cv.wait(lock, [this]() { return m_stop || !m_next_file_ready || !m_full_files.empty() || !m_expired_segments.empty(); });
+      if (m_stop && m_full_files.empty() && m_expired_segments.empty()) {
+        break;
+      }
+
+      auto full_files { std::exchange(m_full_files, {}) };
+      const auto expired_segments { std::exchange(m_expired_segments, {}) };
+      const bool create_next_file { !m_stop && !m_next_file_ready };
+      const auto next_segment_number { m_next_segment_number };
+      lock.unlock();
+
+      full_files.clear();
+      std::error_code error_code;
+      for (const auto number : expired_segments) {
+        std::filesystem::remove(getSegmentPath(number), error_code);
+      }
+
+      std::unique_ptr<MappedFile> next_file;
+      if (create_next_file) {
+        try {
+          next_file = std::make_unique<MappedFile>(getSegmentPath(next_segment_number), m_options.m_segment_size);
+        }
+        catch (const std::exception &) {
+          // Logging from within the sink would only end up here again, so the writes are counted as dropped instead.
+        }
+      }
+
+      lock.lock();
+      if (create_next_file) {
+        m_next_file = std::move(next_file);
+        m_next_file_ready = true;
+        m_background_cv.notify_all();
+      }
+    }
+  }
+}  // namespace display_device
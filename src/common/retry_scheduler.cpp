@@ -6,7 +6,7 @@
 #include "display_device/retry_scheduler.h"
 
 namespace display_device {
-  SchedulerStopToken::SchedulerStopToken(std::function<void()> cleanup):
+  SchedulerStopToken::SchedulerStopToken(MoveOnlyFunction<void()> cleanup):
       m_cleanup { std::move(cleanup) } {
   }
 
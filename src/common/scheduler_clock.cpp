@@ -0,0 +1,74 @@
+/**
+ * @file src/common/scheduler_clock.cpp
+ * @brief Definitions for the clocks used by the RetryScheduler.
+ */
+// class header include
+#include "display_device/scheduler_clock.h"
+
+// system includes
+#include <thread>
+
+namespace display_device {
+  SchedulerClock::time_point
+  SteadySchedulerClock::now() const {
+    return std::chrono::steady_clock::now();
+  }
+
+  void
+  SteadySchedulerClock::sleepFor(const duration time) {
+    std::this_thread::sleep_for(time);
+  }
+
+  bool
+  SteadySchedulerClock::waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, const time_point deadline, const std::function<bool()> &predicate) {
+    return cv.wait_until(lock, deadline, predicate);
+  }
+
+  std::unique_ptr<SchedulerClock::Subscription>
+  SteadySchedulerClock::subscribe(std::function<void()>) {
+    return nullptr;
+  }
+
+  ManualSchedulerClock::ManualSchedulerClock(const time_point start):
+      m_now { start.time_since_epoch().count() } {
+  }
+
+  SchedulerClock::time_point
+  ManualSchedulerClock::now() const {
+    return time_point { duration { m_now.load() } };
+  }
+
+  void
+  ManualSchedulerClock::sleepFor(const duration time) {
+    advance(time);
+  }
+
+  bool
+  ManualSchedulerClock::waitUntil(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, const time_point deadline, const std::function<bool()> &predicate) {
+    // The subscribers are woken up whenever the time is advanced
+    ++m_waiter_count;
+    cv.wait(lock, [&]() { return predicate() || now() >= deadline; });
+    --m_waiter_count;
+    return predicate();
+  }
+
+  std::unique_ptr<SchedulerClock::Subscription>
+  ManualSchedulerClock::subscribe(std::function<void()> callback) {
+    return m_time_jumps.subscribe(std::move(callback));
+  }
+
+  void
+  ManualSchedulerClock::advance(const duration time) {
+    if (time <= duration::zero()) {
+      return;
+    }
+
+    m_now.fetch_add(time.count());
+    m_time_jumps.notify();
+  }
+
+  std::size_t
+  ManualSchedulerClock::getWaiterCount() const {
+    return m_waiter_count.load();
+  }
+}  // namespace display_device
@@ -0,0 +1,44 @@
+/**
+ * @file src/common/scheduler_event_source.cpp
+ * @brief Definitions for the event sources that can wake up the RetryScheduler.
+ */
+// class header include
+#include "display_device/scheduler_event_source.h"
+
+namespace display_device {
+  /**
+   * @brief Removes the callback from the event source once destroyed.
+   */
+  class ManualSchedulerEventSource::ManualSubscription final: public Subscription {
+  public:
+    ManualSubscription(ManualSchedulerEventSource &source, const std::uint64_t id):
+        m_source { source },
+        m_id { id } {
+    }
+
+    ~ManualSubscription() override {
+      std::lock_guard lock { m_source.m_mutex };
+      m_source.m_callbacks.erase(m_id);
+    }
+
+  private:
+    ManualSchedulerEventSource &m_source;
+    std::uint64_t m_id;
+  };
+
+  std::unique_ptr<SchedulerEventSource::Subscription>
+  ManualSchedulerEventSource::subscribe(std::function<void()> callback) {
+    std::lock_guard lock { m_mutex };
+    const auto id { m_next_id++ };
+    m_callbacks.emplace(id, std::move(callback));
+    return std::make_unique<ManualSubscription>(*this, id);
+  }
+
+  void
+  ManualSchedulerEventSource::notify() {
+    std::lock_guard lock { m_mutex };
+    for (const auto &[id, callback] : m_callbacks) {
+      callback();
+    }
+  }
+}  // namespace display_device
@@ -0,0 +1,288 @@
+/**
+ * @file src/common/scheduler_executor.cpp
+ * @brief Definitions for the SchedulerExecutor.
+ */
+// class header include
+#include "display_device/scheduler_executor.h"
+
+// system includes
+#include <algorithm>
+#include <stdexcept>
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief The timer whose callback is currently running on this thread.
+     */
+    struct RunningTimer {
+      const SchedulerExecutor *m_executor { nullptr };
+      std::uint64_t m_id { 0 };
+    };
+
+    thread_local RunningTimer running_timer;
+  }  // namespace
+
+  SchedulerExecutor::Timer::Timer(SchedulerExecutor &executor, const std::uint64_t id):
+      m_executor { executor },
+      m_id { id } {
+  }
+
+  SchedulerExecutor::Timer::~Timer() {
+    m_executor.destroy(m_id);
+  }
+
+  void
+  SchedulerExecutor::Timer::arm(const Clock::time_point deadline) {
+    m_executor.arm(m_id, deadline);
+  }
+
+  void
+  SchedulerExecutor::Timer::disarm() {
+    m_executor.disarm(m_id);
+  }
+
+  SchedulerExecutor::SchedulerExecutor():
+      SchedulerExecutor(Options {}) {
+  }
+
+  SchedulerExecutor::SchedulerExecutor(const Options &options):
+      m_options { options.m_thread_count > 0 ? options : throw std::logic_error { "Thread count must be larger than 0 in SchedulerExecutor!" } } {
+    if (m_options.m_tick_duration <= std::chrono::milliseconds::zero()) {
+      throw std::logic_error { "Tick duration must be larger than 0 in SchedulerExecutor!" };
+    }
+
+    if (m_options.m_wheel_size == 0) {
+      throw std::logic_error { "Wheel size must be larger than 0 in SchedulerExecutor!" };
+    }
+
+    m_wheel.resize(m_options.m_wheel_size);
+    for (std::size_t i = 0; i < m_options.m_thread_count; ++i) {
+      m_workers.emplace_back([this]() { runWorker(); });
+    }
+    m_ticker = std::thread { [this]() { runTicker(); } };
+  }
+
+  SchedulerExecutor::~SchedulerExecutor() {
+    {
+      std::lock_guard lock { m_mutex };
+      m_stop = true;
+    }
+
+    m_ticker_cv.notify_all();
+    m_worker_cv.notify_all();
+    m_ticker.join();
+    for (auto &worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  std::unique_ptr<SchedulerExecutor::Timer>
+  SchedulerExecutor::createTimer(std::function<void()> callback) {
+    if (!callback) {
+      throw std::logic_error { "Empty callback function provided in SchedulerExecutor::createTimer!" };
+    }
+
+    std::lock_guard lock { m_mutex };
+    const auto id { m_next_id++ };
+    m_entries[id].m_callback = std::move(callback);
+    return std::unique_ptr<Timer> { new Timer { *this, id } };
+  }
+
+  void
+  SchedulerExecutor::arm(const std::uint64_t id, const Clock::time_point deadline) {
+    {
+      std::lock_guard lock { m_mutex };
+      auto &entry { m_entries.at(id) };
+      if (!entry.m_armed) {
+        if (m_armed_count++ == 0) {
+          // The ticker was idle, so there is nothing to catch up with.
+          m_processed_tick = std::max(m_processed_tick, getTick(Clock::now()));
+        }
+        entry.m_armed = true;
+      }
+
+      // Round the deadline up, so that the timer never expires earlier than requested
+      const auto tick_duration { std::chrono::duration_cast<Clock::duration>(m_options.m_tick_duration) };
+      const auto since_start { std::max(deadline - m_start, Clock::duration::zero()) };
+      const auto tick { std::max(static_cast<std::uint64_t>((since_start + tick_duration - Clock::duration { 1 }) / tick_duration), m_processed_tick + 1) };
+
+      ++entry.m_arm_sequence;
+      m_wheel[tick % m_wheel.size()].push_back({ id, entry.m_arm_sequence, tick });
+      m_next_armed_tick = std::min(m_next_armed_tick, tick);
+    }
+
+    m_ticker_cv.notify_one();
+  }
+
+  void
+  SchedulerExecutor::disarm(const std::uint64_t id) {
+    std::lock_guard lock { m_mutex };
+    disarmUnlocked(m_entries.at(id));
+  }
+
+  void
+  SchedulerExecutor::destroy(const std::uint64_t id) {
+    std::unique_lock lock { m_mutex };
+    const auto it { m_entries.find(id) };
+    if (it == std::end(m_entries)) {
+      return;
+    }
+
+    auto &entry { it->second };
+    disarmUnlocked(entry);
+    if (entry.m_running) {
+      if (running_timer.m_executor == this && running_timer.m_id == id) {
+        // Destroyed from its own callback, the worker will clean up.
+        entry.m_erase_after_run = true;
+        return;
+      }
+
+      m_done_cv.wait(lock, [&entry]() { return !entry.m_running; });
+    }
+
+    m_entries.erase(it);
+  }
+
+  void
+  SchedulerExecutor::disarmUnlocked(Entry &entry) {
+    if (entry.m_armed) {
+      entry.m_armed = false;
+      --m_armed_count;
+    }
+
+    // Invalidates the items in the wheel and the ready queue
+    ++entry.m_arm_sequence;
+  }
+
+  std::uint64_t
+  SchedulerExecutor::getTick(const Clock::time_point time_point) const {
+    const auto tick_duration { std::chrono::duration_cast<Clock::duration>(m_options.m_tick_duration) };
+    return static_cast<std::uint64_t>(std::max(time_point - m_start, Clock::duration::zero()) / tick_duration);
+  }
+
+  void
+  SchedulerExecutor::processTickUnlocked(const std::uint64_t tick) {
+    auto &bucket { m_wheel[tick % m_wheel.size()] };
+    std::vector<WheelItem> items;
+    items.swap(bucket);
+
+    bool has_ready { false };
+    for (const auto &item : items) {
+      const auto it { m_entries.find(item.m_id) };
+      if (it == std::end(m_entries) || it->second.m_arm_sequence != item.m_arm_sequence) {
+        // Stale item
+        continue;
+      }
+
+      if (item.m_tick > tick) {
+        // Expires in one of the next wheel rotations
+        bucket.push_back(item);
+        continue;
+      }
+
+      auto &entry { it->second };
+      if (entry.m_running) {
+        // Retry on the next tick, so that the same callback is never executed concurrently
+        m_wheel[(tick + 1) % m_wheel.size()].push_back({ item.m_id, item.m_arm_sequence, tick + 1 });
+        continue;
+      }
+
+      entry.m_armed = false;
+      --m_armed_count;
+      m_ready.emplace_back(item.m_id, item.m_arm_sequence);
+      has_ready = true;
+    }
+
+    if (has_ready) {
+      m_worker_cv.notify_all();
+    }
+  }
+
+  std::uint64_t
+  SchedulerExecutor::findNextArmedTickUnlocked() const {
+    auto next_tick { std::numeric_limits<std::uint64_t>::max() };
+    for (const auto &bucket : m_wheel) {
+      for (const auto &item : bucket) {
+        if (item.m_tick >= next_tick) {
+          continue;
+        }
+
+        const auto it { m_entries.find(item.m_id) };
+        if (it != std::end(m_entries) && it->second.m_arm_sequence == item.m_arm_sequence) {
+          next_tick = item.m_tick;
+        }
+      }
+    }
+    return next_tick;
+  }
+
+  void
+  SchedulerExecutor::runTicker() {
+    const auto tick_duration { std::chrono::duration_cast<Clock::duration>(m_options.m_tick_duration) };
+
+    std::unique_lock lock { m_mutex };
+    while (!m_stop) {
+      if (m_armed_count == 0) {
+        m_ticker_cv.wait(lock, [this]() { return m_stop || m_armed_count > 0; });
+        continue;
+      }
+
+      // Sleep through the ticks without any armed timers instead of waking up on every one of them
+      const auto next_tick { std::max(m_next_armed_tick, m_processed_tick + 1) };
+      const auto next_tick_time { m_start + tick_duration * static_cast<Clock::rep>(next_tick) };
+      if (Clock::now() < next_tick_time) {
+        m_ticker_cv.wait_until(lock, next_tick_time);
+        continue;
+      }
+
+      // Catch up with all the elapsed ticks, but there is no need to process the same bucket twice
+      const auto last_tick { getTick(Clock::now()) };
+      const auto first_tick { std::max(m_processed_tick + 1, last_tick >= m_wheel.size() ? last_tick - m_wheel.size() + 1 : 0) };
+      for (auto tick { first_tick }; tick <= last_tick; ++tick) {
+        processTickUnlocked(tick);
+      }
+      m_processed_tick = last_tick;
+      m_next_armed_tick = findNextArmedTickUnlocked();
+    }
+  }
+
+  void
+  SchedulerExecutor::runWorker() {
+    std::unique_lock lock { m_mutex };
+    while (true) {
+      m_worker_cv.wait(lock, [this]() { return m_stop || !m_ready.empty(); });
+      if (m_stop) {
+        break;
+      }
+
+      const auto [id, arm_sequence] { m_ready.front() };
+      m_ready.pop_front();
+
+      const auto it { m_entries.find(id) };
+      if (it == std::end(m_entries) || it->second.m_arm_sequence != arm_sequence || it->second.m_running) {
+        // Timer was re-armed, disarmed or destroyed in the meantime
+        continue;
+      }
+
+      auto &entry { it->second };
+      entry.m_running = true;
+      lock.unlock();
+
+      running_timer = { this, id };
+      try {
+        entry.m_callback();
+      }
+      catch (...) {
+        // There is no one to propagate the exception to and we must not die here.
+      }
+      running_timer = {};
+
+      lock.lock();
+      entry.m_running = false;
+      if (entry.m_erase_after_run) {
+        m_entries.erase(id);
+      }
+      m_done_cv.notify_all();
+    }
+  }
+}  // namespace display_device
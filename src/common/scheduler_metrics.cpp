@@ -0,0 +1,106 @@
+/**
+ * @file src/common/scheduler_metrics.cpp
+ * @brief Definitions for the RetryScheduler metrics.
+ */
+// class header include
+#include "display_device/scheduler_metrics.h"
+
+// system includes
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace display_device {
+  std::chrono::microseconds
+  LatencyHistogram::Snapshot::getUpperBound(const std::size_t index) {
+    if (index + 1 >= m_bucket_count) {
+      return std::chrono::microseconds::max();
+    }
+    return std::chrono::microseconds { std::chrono::microseconds::rep { 1 } << index };
+  }
+
+  std::chrono::microseconds
+  LatencyHistogram::Snapshot::getPercentile(const double percentile) const {
+    if (m_count == 0) {
+      return std::chrono::microseconds::zero();
+    }
+
+    const auto rank { std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(m_count)))) };
+    std::uint64_t accumulated { 0 };
+    for (std::size_t i = 0; i < m_bucket_count; ++i) {
+      accumulated += m_buckets[i];
+      if (accumulated >= rank) {
+        // The bucket bound can be way above the largest value, so the max is a better estimate then
+        return std::min(getUpperBound(i), m_max);
+      }
+    }
+    return m_max;
+  }
+
+  void
+  LatencyHistogram::record(const std::chrono::steady_clock::duration value) {
+    const auto value_us { static_cast<std::uint64_t>(std::max(std::chrono::duration_cast<std::chrono::microseconds>(value).count(), std::chrono::microseconds::rep { 0 })) };
+    const auto index { std::min<std::size_t>(static_cast<std::size_t>(std::bit_width(value_us)), m_bucket_count - 1) };
+
+    m_buckets[index].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_total_us.fetch_add(value_us, std::memory_order_relaxed);
+
+    auto max_us { m_max_us.load(std::memory_order_relaxed) };
+    while (max_us < value_us && !m_max_us.compare_exchange_weak(max_us, value_us, std::memory_order_relaxed)) {
+      // Retry with the updated value
+    }
+  }
+
+  LatencyHistogram::Snapshot
+  LatencyHistogram::getSnapshot() const {
+    Snapshot snapshot;
+    for (std::size_t i = 0; i < m_bucket_count; ++i) {
+      snapshot.m_buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+    }
+    snapshot.m_count = m_count.load(std::memory_order_relaxed);
+    snapshot.m_total = std::chrono::microseconds { static_cast<std::chrono::microseconds::rep>(m_total_us.load(std::memory_order_relaxed)) };
+    snapshot.m_max = std::chrono::microseconds { static_cast<std::chrono::microseconds::rep>(m_max_us.load(std::memory_order_relaxed)) };
+    return snapshot;
+  }
+
+  void
+  SchedulerMetrics::recordAttempt(const Outcome outcome, const std::chrono::steady_clock::duration duration) {
+    m_attempts.fetch_add(1, std::memory_order_relaxed);
+    if (outcome == Outcome::Success) {
+      m_successes.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (outcome == Outcome::Exception) {
+      m_exceptions.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_callback_duration.record(duration);
+  }
+
+  void
+  SchedulerMetrics::recordExhausted() {
+    m_exhausted.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void
+  SchedulerMetrics::recordLockWait(const std::chrono::steady_clock::duration duration) {
+    m_lock_wait.record(duration);
+  }
+
+  void
+  SchedulerMetrics::recordFirstRunDelay(const std::chrono::steady_clock::duration duration) {
+    m_first_run_delay.record(duration);
+  }
+
+  SchedulerMetricsSnapshot
+  SchedulerMetrics::getSnapshot() const {
+    return {
+      .m_attempts = m_attempts.load(std::memory_order_relaxed),
+      .m_successes = m_successes.load(std::memory_order_relaxed),
+      .m_exceptions = m_exceptions.load(std::memory_order_relaxed),
+      .m_exhausted = m_exhausted.load(std::memory_order_relaxed),
+      .m_lock_wait = m_lock_wait.getSnapshot(),
+      .m_callback_duration = m_callback_duration.getSnapshot(),
+      .m_first_run_delay = m_first_run_delay.getSnapshot()
+    };
+  }
+}  // namespace display_device
@@ -27,22 +27,22 @@ namespace display_device {
   SettingsManager::ApplyResult
   SettingsManager::applySettings(const SingleDisplayConfiguration &config) {
     const auto api_access { m_dd_api->isApiAccessAvailable() };
-    DD_LOG(info) << "Trying to apply display device settings. API is available: " << toJson(api_access);
+    DD_LOG_CH(settings, info) << "Trying to apply display device settings. API is available: " << toJson(api_access);
 
     if (!api_access) {
       return ApplyResult::ApiTemporarilyUnavailable;
     }
-    DD_LOG(info) << "Using the following configuration:\n"
-                 << toJson(config);
+    DD_LOG_CH(settings, info) << "Using the following configuration:\n"
+                              << DD_LOG_DEDUP(toJson(config));
 
     const auto topology_before_changes { m_dd_api->getCurrentTopology() };
     if (!m_dd_api->isTopologyValid(topology_before_changes)) {
-      DD_LOG(error) << "Retrieved current topology is invalid:\n"
-                    << toJson(topology_before_changes);
+      DD_LOG_CH(settings, error) << "Retrieved current topology is invalid:\n"
+                                 << toJson(topology_before_changes);
       return ApplyResult::DevicePrepFailed;
     }
-    DD_LOG(info) << "Active topology before any changes:\n"
-                 << toJson(topology_before_changes);
+    DD_LOG_CH(settings, info) << "Active topology before any changes:\n"
+                              << DD_LOG_DEDUP(toJson(topology_before_changes));
 
     bool system_settings_touched { false };
     boost::scope::scope_exit hdr_blank_always_executed_guard { [this, &system_settings_touched]() {
@@ -57,7 +57,7 @@ namespace display_device {
       // To keel it simple, these settings will not be restored!
       const auto result { m_dd_api->setTopology(topology) };
       if (!result) {
-        DD_LOG(error) << "Failed to revert back to topology in the topology guard!";
+        DD_LOG_CH(settings, error) << "Failed to revert back to topology in the topology guard!";
         if (release_context) {
           // We are currently in the topology for which the context was captured.
           // We have also failed to revert back to some previous one, so we remain in this topology for
@@ -103,7 +103,7 @@ namespace display_device {
     // We will always keep the new state persistently, even if there are no new meaningful changes, because
     // we want to preserve the initial state for consistency.
     if (!m_persistence_state->persistState(new_state)) {
-      DD_LOG(error) << "Failed to save reverted settings! Undoing everything...";
+      DD_LOG_CH(settings, error) << "Failed to save reverted settings! Undoing everything...";
       return ApplyResult::PersistenceSaveFailed;
     }
 
@@ -124,17 +124,17 @@ namespace display_device {
   SettingsManager::prepareTopology(const SingleDisplayConfiguration &config, const ActiveTopology &topology_before_changes, bool &release_context, bool &system_settings_touched) {
     const EnumeratedDeviceList devices { m_dd_api->enumAvailableDevices() };
     if (devices.empty()) {
-      DD_LOG(error) << "Failed to enumerate display devices!";
+      DD_LOG_CH(settings, error) << "Failed to enumerate display devices!";
       return std::nullopt;
     }
-    DD_LOG(info) << "Currently available devices:\n"
-                 << toJson(devices);
+    DD_LOG_CH(settings, info) << "Currently available devices:\n"
+                              << DD_LOG_DEDUP(toJson(devices));
 
     if (!config.m_device_id.empty()) {
       auto device_it { std::ranges::find_if(devices, [device_id = config.m_device_id](const auto &item) { return item.m_device_id == device_id; }) };
       if (device_it == std::end(devices)) {
         // Do not use toJson in case the user entered some BS string...
-        DD_LOG(error) << "Device \"" << config.m_device_id << "\" is not available in the system!";
+        DD_LOG_CH(settings, error) << "Device \"" << config.m_device_id << "\" is not available in the system!";
         return std::nullopt;
       }
     }
@@ -157,23 +157,23 @@ namespace display_device {
 
     const auto &[new_topology, device_to_configure, additional_devices_to_configure] = win_utils::computeNewTopologyAndMetadata(config.m_device_prep, config.m_device_id, *stripped_initial_state);
     const auto change_is_needed { !m_dd_api->isTopologyTheSame(topology_before_changes, new_topology) };
-    DD_LOG(info) << "Newly computed display device topology data:\n"
-                 << "  - topology: " << toJson(new_topology, JSON_COMPACT) << "\n"
-                 << "  - change is needed: " << toJson(change_is_needed, JSON_COMPACT) << "\n"
-                 << "  - additional devices to configure: " << toJson(additional_devices_to_configure, JSON_COMPACT);
+    DD_LOG_CH(settings, info) << "Newly computed display device topology data:\n"
+                              << "  - topology: " << toJson(new_topology, JSON_COMPACT) << "\n"
+                              << "  - change is needed: " << toJson(change_is_needed, JSON_COMPACT) << "\n"
+                              << "  - additional devices to configure: " << toJson(additional_devices_to_configure, JSON_COMPACT);
 
     // This check is mainly to cover the case for "config.device_prep == VerifyOnly" as we at least
     // have to validate that the device exists, but it doesn't hurt to double-check it in all cases.
     if (!win_utils::flattenTopology(new_topology).contains(device_to_configure)) {
-      DD_LOG(error) << "Device " << toJson(device_to_configure, JSON_COMPACT) << " is not active!";
+      DD_LOG_CH(settings, error) << "Device " << toJson(device_to_configure, JSON_COMPACT) << " is not active!";
       return std::nullopt;
     }
 
     if (change_is_needed) {
       if (cached_state && !m_dd_api->isTopologyTheSame(cached_state->m_modified.m_topology, new_topology)) {
-        DD_LOG(warning) << "To apply new display device settings, previous modifications must be undone! Trying to undo them now.";
+        DD_LOG_CH(settings, warning) << "To apply new display device settings, previous modifications must be undone! Trying to undo them now.";
         if (!revertModifiedSettings(topology_before_changes, system_settings_touched)) {
-          DD_LOG(error) << "Failed to apply new configuration, because the previous settings could not be reverted!";
+          DD_LOG_CH(settings, error) << "Failed to apply new configuration, because the previous settings could not be reverted!";
           return std::nullopt;
         }
       }
@@ -187,7 +187,7 @@ namespace display_device {
           // Only capture the context when switching from initial topology. All the other intermediate states, like non-existent
           // capture state after system restart are to be avoided.
           if (!m_audio_context_api->capture()) {
-            DD_LOG(error) << "Failed to capture audio context!";
+            DD_LOG_CH(settings, error) << "Failed to capture audio context!";
             return std::nullopt;
           }
         }
@@ -195,7 +195,7 @@ namespace display_device {
 
       system_settings_touched = true;
       if (!m_dd_api->setTopology(new_topology)) {
-        DD_LOG(error) << "Failed to apply new configuration, because a new topology could not be set!";
+        DD_LOG_CH(settings, error) << "Failed to apply new configuration, because a new topology could not be set!";
         return std::nullopt;
       }
 
@@ -218,8 +218,8 @@ namespace display_device {
     if (ensure_primary || might_need_to_restore) {
       current_primary_device = win_utils::getPrimaryDevice(*m_dd_api, new_state.m_modified.m_topology);
       if (current_primary_device.empty()) {
-        DD_LOG(error) << "Failed to get primary device for the topology! Searched topology:\n"
-                      << toJson(new_state.m_modified.m_topology);
+        DD_LOG_CH(settings, error) << "Failed to get primary device for the topology! Searched topology:\n"
+                                   << toJson(new_state.m_modified.m_topology);
         return false;
       }
     }
@@ -228,9 +228,9 @@ namespace display_device {
       if (current_primary_device != new_device) {
         system_settings_touched = true;
 
-        DD_LOG(info) << info_preamble << toJson(new_device);
+        DD_LOG_CH(settings, info) << info_preamble << toJson(new_device);
         if (!m_dd_api->setAsPrimary(new_device)) {
-          DD_LOG(error) << error_log;
+          DD_LOG_CH(settings, error) << error_log;
           return false;
         }
 
@@ -275,17 +275,17 @@ namespace display_device {
     if (change_required || might_need_to_restore) {
       current_display_modes = m_dd_api->getCurrentDisplayModes(win_utils::flattenTopology(new_state.m_modified.m_topology));
       if (current_display_modes.empty()) {
-        DD_LOG(error) << "Failed to get current display modes!";
+        DD_LOG_CH(settings, error) << "Failed to get current display modes!";
         return false;
       }
     }
 
     const auto try_change { [&](const DeviceDisplayModeMap &new_modes, const auto info_preamble, const auto error_log) {
       if (current_display_modes != new_modes) {
-        DD_LOG(info) << info_preamble << toJson(new_modes);
+        DD_LOG_CH(settings, info) << info_preamble << toJson(new_modes);
         if (!m_dd_api->setDisplayModes(new_modes)) {
           system_settings_touched = true;
-          DD_LOG(error) << error_log;
+          DD_LOG_CH(settings, error) << error_log;
           return false;
         }
 
@@ -338,7 +338,7 @@ namespace display_device {
     if (change_required || might_need_to_restore) {
       current_hdr_states = m_dd_api->getCurrentHdrStates(win_utils::flattenTopology(new_state.m_modified.m_topology));
       if (current_hdr_states.empty()) {
-        DD_LOG(error) << "Failed to get current HDR states!";
+        DD_LOG_CH(settings, error) << "Failed to get current HDR states!";
         return false;
       }
     }
@@ -347,9 +347,9 @@ namespace display_device {
       if (current_hdr_states != new_states) {
         system_settings_touched = true;
 
-        DD_LOG(info) << info_preamble << toJson(new_states);
+        DD_LOG_CH(settings, info) << info_preamble << toJson(new_states);
         if (!m_dd_api->setHdrStates(new_states)) {
-          DD_LOG(error) << error_log;
+          DD_LOG_CH(settings, error) << error_log;
           return false;
         }
 
@@ -32,8 +32,8 @@ namespace display_device {
       throw std::logic_error { "Nullptr provided for PersistentState in SettingsManager!" };
     }
 
-    DD_LOG(info) << "Provided workaround settings for SettingsManager:\n"
-                 << toJson(m_workarounds);
+    DD_LOG_CH(settings, info) << "Provided workaround settings for SettingsManager:\n"
+                              << toJson(m_workarounds);
   }
 
   EnumeratedDeviceList
@@ -53,9 +53,9 @@ namespace display_device {
       return true;
     }
 
-    DD_LOG(info) << "Trying to reset persistent display device settings.";
+    DD_LOG_CH(settings, info) << "Trying to reset persistent display device settings.";
     if (!m_persistence_state->persistState(std::nullopt)) {
-      DD_LOG(error) << "Failed to clear persistence!";
+      DD_LOG_CH(settings, error) << "Failed to clear persistence!";
       return false;
     }
 
@@ -31,7 +31,7 @@ namespace display_device {
     }
 
     const auto api_access { m_dd_api->isApiAccessAvailable() };
-    DD_LOG(info) << "Trying to revert applied display device settings. API is available: " << toJson(api_access);
+    DD_LOG_CH(settings, info) << "Trying to revert applied display device settings. API is available: " << toJson(api_access);
 
     if (!api_access) {
       return false;
@@ -39,8 +39,8 @@ namespace display_device {
 
     const auto current_topology { m_dd_api->getCurrentTopology() };
     if (!m_dd_api->isTopologyValid(current_topology)) {
-      DD_LOG(error) << "Retrieved current topology is invalid:\n"
-                    << toJson(current_topology);
+      DD_LOG_CH(settings, error) << "Retrieved current topology is invalid:\n"
+                                 << toJson(current_topology);
       return false;
     }
 
@@ -59,8 +59,8 @@ namespace display_device {
       const bool is_topology_the_same { m_dd_api->isTopologyTheSame(current_topology, topology_to_restore) };
       system_settings_touched = system_settings_touched || !is_topology_the_same;
       if (!is_topology_the_same && !m_dd_api->setTopology(topology_to_restore)) {
-        DD_LOG(error) << "failed to revert topology in revertSettings topology guard! Used the following topology:\n"
-                      << toJson(topology_to_restore);
+        DD_LOG_CH(settings, error) << "failed to revert topology in revertSettings topology guard! Used the following topology:\n"
+                                   << toJson(topology_to_restore);
       }
     } };
 
@@ -72,8 +72,8 @@ namespace display_device {
     }
 
     if (!m_dd_api->isTopologyValid(cached_state->m_initial.m_topology)) {
-      DD_LOG(error) << "Trying to revert to an invalid initial topology:\n"
-                    << toJson(cached_state->m_initial.m_topology);
+      DD_LOG_CH(settings, error) << "Trying to revert to an invalid initial topology:\n"
+                                 << toJson(cached_state->m_initial.m_topology);
       return false;
     }
 
@@ -81,13 +81,13 @@ namespace display_device {
     const bool need_to_switch_topology { !is_topology_the_same || switched_to_modified_topology };
     system_settings_touched = system_settings_touched || !is_topology_the_same;
     if (need_to_switch_topology && !m_dd_api->setTopology(cached_state->m_initial.m_topology)) {
-      DD_LOG(error) << "Failed to change topology to:\n"
-                    << toJson(cached_state->m_initial.m_topology);
+      DD_LOG_CH(settings, error) << "Failed to change topology to:\n"
+                                 << toJson(cached_state->m_initial.m_topology);
       return false;
     }
 
     if (!m_persistence_state->persistState(std::nullopt)) {
-      DD_LOG(error) << "Failed to save reverted settings! Undoing initial topology changes...";
+      DD_LOG_CH(settings, error) << "Failed to save reverted settings! Undoing initial topology changes...";
       return false;
     }
 
@@ -108,16 +108,16 @@ namespace display_device {
     }
 
     if (!m_dd_api->isTopologyValid(cached_state->m_modified.m_topology)) {
-      DD_LOG(error) << "Trying to revert modified settings using invalid topology:\n"
-                    << toJson(cached_state->m_modified.m_topology);
+      DD_LOG_CH(settings, error) << "Trying to revert modified settings using invalid topology:\n"
+                                 << toJson(cached_state->m_modified.m_topology);
       return false;
     }
 
     const bool is_topology_the_same { m_dd_api->isTopologyTheSame(current_topology, cached_state->m_modified.m_topology) };
     system_settings_touched = !is_topology_the_same;
     if (!is_topology_the_same && !m_dd_api->setTopology(cached_state->m_modified.m_topology)) {
-      DD_LOG(error) << "Failed to change topology to:\n"
-                    << toJson(cached_state->m_modified.m_topology);
+      DD_LOG_CH(settings, error) << "Failed to change topology to:\n"
+                                 << toJson(cached_state->m_modified.m_topology);
       return false;
     }
     if (switched_topology) {
@@ -131,8 +131,8 @@ namespace display_device {
       if (current_states != cached_state->m_modified.m_original_hdr_states) {
         system_settings_touched = true;
 
-        DD_LOG(info) << "Trying to change back the HDR states to:\n"
-                     << toJson(cached_state->m_modified.m_original_hdr_states);
+        DD_LOG_CH(settings, info) << "Trying to change back the HDR states to:\n"
+                                  << toJson(cached_state->m_modified.m_original_hdr_states);
         if (!m_dd_api->setHdrStates(cached_state->m_modified.m_original_hdr_states)) {
           // Error already logged
           return false;
@@ -147,8 +147,8 @@ namespace display_device {
     if (!cached_state->m_modified.m_original_modes.empty()) {
       const auto current_modes { m_dd_api->getCurrentDisplayModes(win_utils::flattenTopology(cached_state->m_modified.m_topology)) };
       if (current_modes != cached_state->m_modified.m_original_modes) {
-        DD_LOG(info) << "Trying to change back the display modes to:\n"
-                     << toJson(cached_state->m_modified.m_original_modes);
+        DD_LOG_CH(settings, info) << "Trying to change back the display modes to:\n"
+                                  << toJson(cached_state->m_modified.m_original_modes);
         if (!m_dd_api->setDisplayModes(cached_state->m_modified.m_original_modes)) {
           system_settings_touched = true;
           // Error already logged
@@ -172,7 +172,7 @@ namespace display_device {
       if (current_primary_device != cached_state->m_modified.m_original_primary_device) {
         system_settings_touched = true;
 
-        DD_LOG(info) << "Trying to change back the original primary device to: " << toJson(cached_state->m_modified.m_original_primary_device);
+        DD_LOG_CH(settings, info) << "Trying to change back the original primary device to: " << toJson(cached_state->m_modified.m_original_primary_device);
         if (!m_dd_api->setAsPrimary(cached_state->m_modified.m_original_primary_device)) {
           // Error already logged
           return false;
@@ -185,7 +185,7 @@ namespace display_device {
     auto cleared_data { *cached_state };
     cleared_data.m_modified = { cleared_data.m_modified.m_topology };
     if (!m_persistence_state->persistState(cleared_data)) {
-      DD_LOG(error) << "Failed to save reverted settings! Undoing changes to modified topology...";
+      DD_LOG_CH(settings, error) << "Failed to save reverted settings! Undoing changes to modified topology...";
       return false;
     }
 
@@ -150,7 +150,7 @@ namespace display_device::win_utils {
   stripTopologyOfUnavailableDevices(WinDisplayDeviceInterface &win_dd, const ActiveTopology &topology) {
     const auto devices { win_dd.enumAvailableDevices() };
     if (devices.empty()) {
-      DD_LOG(error) << "Failed to enumerate available devices for stripping topology!";
+      DD_LOG_CH(settings, error) << "Failed to enumerate available devices for stripping topology!";
       return {};
     }
 
@@ -188,7 +188,7 @@ namespace display_device::win_utils {
 
     const auto primary_devices { getDeviceIds(devices, primaryOnlyDevices) };
     if (primary_devices.empty()) {
-      DD_LOG(error) << "Enumerated device list does not contain primary devices!";
+      DD_LOG_CH(settings, error) << "Enumerated device list does not contain primary devices!";
       return std::nullopt;
     }
 
@@ -231,7 +231,7 @@ namespace display_device::win_utils {
     auto initial_primary_devices { stripDevices(initial_state.m_primary_devices, devices) };
 
     if (stripped_initial_topology.empty()) {
-      DD_LOG(error) << "Enumerated device list does not contain ANY of the devices from the initial state!";
+      DD_LOG_CH(settings, error) << "Enumerated device list does not contain ANY of the devices from the initial state!";
       return std::nullopt;
     }
 
@@ -239,13 +239,13 @@ namespace display_device::win_utils {
       // The initial primay device is no longer available, so maybe it makes sense to use the current one. Maybe...
       initial_primary_devices = getDeviceIds(devices, primaryOnlyDevices);
       if (initial_primary_devices.empty()) {
-        DD_LOG(error) << "Enumerated device list does not contain primary devices!";
+        DD_LOG_CH(settings, error) << "Enumerated device list does not contain primary devices!";
         return std::nullopt;
       }
     }
 
     if (initial_state.m_topology != stripped_initial_topology || initial_state.m_primary_devices != initial_primary_devices) {
-      DD_LOG(warning) << "Trying to apply configuration without reverting back to initial topology first, however not all devices from that "
+      DD_LOG_CH(settings, warning) << "Trying to apply configuration without reverting back to initial topology first, however not all devices from that "
                          "topology are available.\n"
                       << "Will try adapting the initial topology that is used as a base:\n"
                       << "  - topology: " << toJson(initial_state.m_topology, JSON_COMPACT) << " -> " << toJson(stripped_initial_topology, JSON_COMPACT) << "\n"
@@ -265,12 +265,12 @@ namespace display_device::win_utils {
     auto additional_devices_to_configure { configuring_unspecified_devices ?
                                              std::set<std::string> { std::next(std::begin(initial_state.m_primary_devices)), std::end(initial_state.m_primary_devices) } :
                                              tryGetOtherDevicesInTheSameGroup(initial_state.m_topology, device_to_configure) };
-    DD_LOG(info) << "Will compute new display device topology from the following input:\n"
-                 << "  - initial topology: " << toJson(initial_state.m_topology, JSON_COMPACT) << "\n"
-                 << "  - initial primary devices: " << toJson(initial_state.m_primary_devices, JSON_COMPACT) << "\n"
-                 << "  - configuring unspecified device: " << toJson(configuring_unspecified_devices, JSON_COMPACT) << "\n"
-                 << "  - device to configure: " << toJson(device_to_configure, JSON_COMPACT) << "\n"
-                 << "  - additional devices to configure: " << toJson(additional_devices_to_configure, JSON_COMPACT);
+    DD_LOG_CH(settings, info) << "Will compute new display device topology from the following input:\n"
+                              << "  - initial topology: " << toJson(initial_state.m_topology, JSON_COMPACT) << "\n"
+                              << "  - initial primary devices: " << toJson(initial_state.m_primary_devices, JSON_COMPACT) << "\n"
+                              << "  - configuring unspecified device: " << toJson(configuring_unspecified_devices, JSON_COMPACT) << "\n"
+                              << "  - device to configure: " << toJson(device_to_configure, JSON_COMPACT) << "\n"
+                              << "  - additional devices to configure: " << toJson(additional_devices_to_configure, JSON_COMPACT);
 
     const auto new_topology { computeNewTopology(device_prep, configuring_unspecified_devices, device_to_configure, additional_devices_to_configure, initial_state.m_topology) };
     additional_devices_to_configure = tryGetOtherDevicesInTheSameGroup(new_topology, device_to_configure);
@@ -365,14 +365,14 @@ namespace display_device::win_utils {
 
     const auto topology { win_dd.getCurrentTopology() };
     if (!win_dd.isTopologyValid(topology)) {
-      DD_LOG(error) << "Got an invalid topology while trying to blank HDR states!";
+      DD_LOG_CH(settings, error) << "Got an invalid topology while trying to blank HDR states!";
       return;
     }
 
     const auto current_states { win_dd.getCurrentHdrStates(flattenTopology(topology)) };
     if (current_states.empty()) {
-      DD_LOG(error) << "Failed to get current HDR states! Topology:\n"
-                    << toJson(topology);
+      DD_LOG_CH(settings, error) << "Failed to get current HDR states! Topology:\n"
+                                 << toJson(topology);
       return;
     }
 
@@ -394,26 +394,26 @@ namespace display_device::win_utils {
       return;
     }
 
-    DD_LOG(info) << "Applying HDR state \"blank\" workaround (" << delay->count() << "ms) to devices: " << toJson(device_ids, JSON_COMPACT);
+    DD_LOG_CH(settings, info) << "Applying HDR state \"blank\" workaround (" << delay->count() << "ms) to devices: " << toJson(device_ids, JSON_COMPACT);
     if (!win_dd.setHdrStates(inverse_states)) {
-      DD_LOG(error) << "Failed to apply inverse HDR states during \"blank\"!";
+      DD_LOG_CH(settings, error) << "Failed to apply inverse HDR states during \"blank\"!";
       return;
     }
 
     std::this_thread::sleep_for(*delay);
     if (!win_dd.setHdrStates(original_states)) {
-      DD_LOG(error) << "Failed to apply original HDR states during \"blank\"!";
+      DD_LOG_CH(settings, error) << "Failed to apply original HDR states during \"blank\"!";
     }
   }
 
   DdGuardFn
   topologyGuardFn(WinDisplayDeviceInterface &win_dd, const ActiveTopology &topology) {
-    DD_LOG(debug) << "Got topology in topologyGuardFn:\n"
-                  << toJson(topology);
+    DD_LOG_CH(settings, debug) << "Got topology in topologyGuardFn:\n"
+                               << toJson(topology);
     return [&win_dd, topology]() {
       if (!win_dd.setTopology(topology)) {
-        DD_LOG(error) << "failed to revert topology in topologyGuardFn! Used the following topology:\n"
-                      << toJson(topology);
+        DD_LOG_CH(settings, error) << "failed to revert topology in topologyGuardFn! Used the following topology:\n"
+                                   << toJson(topology);
       }
     };
   }
@@ -425,12 +425,12 @@ namespace display_device::win_utils {
 
   DdGuardFn
   modeGuardFn(WinDisplayDeviceInterface &win_dd, const DeviceDisplayModeMap &modes) {
-    DD_LOG(debug) << "Got modes in modeGuardFn:\n"
-                  << toJson(modes);
+    DD_LOG_CH(settings, debug) << "Got modes in modeGuardFn:\n"
+                               << toJson(modes);
     return [&win_dd, modes]() {
       if (!win_dd.setDisplayModes(modes)) {
-        DD_LOG(error) << "failed to revert display modes in modeGuardFn! Used the following modes:\n"
-                      << toJson(modes);
+        DD_LOG_CH(settings, error) << "failed to revert display modes in modeGuardFn! Used the following modes:\n"
+                                   << toJson(modes);
       }
     };
   }
@@ -442,12 +442,12 @@ namespace display_device::win_utils {
 
   DdGuardFn
   primaryGuardFn(WinDisplayDeviceInterface &win_dd, const std::string &primary_device) {
-    DD_LOG(debug) << "Got primary device in primaryGuardFn:\n"
-                  << toJson(primary_device);
+    DD_LOG_CH(settings, debug) << "Got primary device in primaryGuardFn:\n"
+                               << toJson(primary_device);
     return [&win_dd, primary_device]() {
       if (!win_dd.setAsPrimary(primary_device)) {
-        DD_LOG(error) << "failed to revert primary device in primaryGuardFn! Used the following device id:\n"
-                      << toJson(primary_device);
+        DD_LOG_CH(settings, error) << "failed to revert primary device in primaryGuardFn! Used the following device id:\n"
+                                   << toJson(primary_device);
       }
     };
   }
@@ -459,12 +459,12 @@ namespace display_device::win_utils {
 
   DdGuardFn
   hdrStateGuardFn(WinDisplayDeviceInterface &win_dd, const HdrStateMap &states) {
-    DD_LOG(debug) << "Got states in hdrStateGuardFn:\n"
-                  << toJson(states);
+    DD_LOG_CH(settings, debug) << "Got states in hdrStateGuardFn:\n"
+                               << toJson(states);
     return [&win_dd, states]() {
       if (!win_dd.setHdrStates(states)) {
-        DD_LOG(error) << "failed to revert HDR states in hdrStateGuardFn! Used the following HDR states:\n"
-                      << toJson(states);
+        DD_LOG_CH(settings, error) << "failed to revert HDR states in hdrStateGuardFn! Used the following HDR states:\n"
+                                   << toJson(states);
       }
     };
   }
@@ -149,7 +149,7 @@ namespace display_device {
 
       LONG result { DisplayConfigGetDeviceInfo(&target_name.header) };
       if (result != ERROR_SUCCESS) {
-        DD_LOG(error) << w_api.getErrorString(result) << " failed to get target device name!";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(result) << " failed to get target device name!";
         return {};
       }
 
@@ -165,11 +165,11 @@ namespace display_device {
     getDeviceInterfaceDetail(const WinApiLayerInterface &w_api, HDEVINFO dev_info_handle, SP_DEVICE_INTERFACE_DATA &dev_interface_data, std::wstring &dev_interface_path, SP_DEVINFO_DATA &dev_info_data) {
       DWORD required_size_in_bytes { 0 };
       if (SetupDiGetDeviceInterfaceDetailW(dev_info_handle, &dev_interface_data, nullptr, 0, &required_size_in_bytes, nullptr)) {
-        DD_LOG(error) << "\"SetupDiGetDeviceInterfaceDetailW\" did not fail, what?!";
+        DD_LOG_CH(winapi, error) << "\"SetupDiGetDeviceInterfaceDetailW\" did not fail, what?!";
         return false;
       }
       else if (required_size_in_bytes <= 0) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInterfaceDetailW\" failed while getting size.";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInterfaceDetailW\" failed while getting size.";
         return false;
       }
 
@@ -181,7 +181,7 @@ namespace display_device {
       detail_data->cbSize = sizeof(SP_DEVICE_INTERFACE_DETAIL_DATA_W);
 
       if (!SetupDiGetDeviceInterfaceDetailW(dev_info_handle, &dev_interface_data, detail_data, required_size_in_bytes, nullptr, &dev_info_data)) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInterfaceDetailW\" failed.";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInterfaceDetailW\" failed.";
         return false;
       }
 
@@ -198,17 +198,17 @@ namespace display_device {
     getDeviceInstanceId(const WinApiLayerInterface &w_api, HDEVINFO dev_info_handle, SP_DEVINFO_DATA &dev_info_data, std::wstring &instance_id) {
       DWORD required_size_in_characters { 0 };
       if (SetupDiGetDeviceInstanceIdW(dev_info_handle, &dev_info_data, nullptr, 0, &required_size_in_characters)) {
-        DD_LOG(error) << "\"SetupDiGetDeviceInstanceIdW\" did not fail, what?!";
+        DD_LOG_CH(winapi, error) << "\"SetupDiGetDeviceInstanceIdW\" did not fail, what?!";
         return false;
       }
       else if (required_size_in_characters <= 0) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInstanceIdW\" failed while getting size.";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInstanceIdW\" failed while getting size.";
         return false;
       }
 
       instance_id.resize(required_size_in_characters);
       if (!SetupDiGetDeviceInstanceIdW(dev_info_handle, &dev_info_data, instance_id.data(), instance_id.size(), nullptr)) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInstanceIdW\" failed.";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInstanceIdW\" failed.";
         return false;
       }
 
@@ -225,7 +225,7 @@ namespace display_device {
       // We could just directly open the registry key as the path is known, but we can also use the this
       HKEY reg_key { SetupDiOpenDevRegKey(dev_info_handle, &dev_info_data, DICS_FLAG_GLOBAL, 0, DIREG_DEV, KEY_READ) };
       if (reg_key == INVALID_HANDLE_VALUE) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiOpenDevRegKey\" failed.";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiOpenDevRegKey\" failed.";
         return false;
       }
 
@@ -233,7 +233,7 @@ namespace display_device {
         boost::scope::scope_exit([&w_api, &reg_key]() {
           const auto status { RegCloseKey(reg_key) };
           if (status != ERROR_SUCCESS) {
-            DD_LOG(error) << w_api.getErrorString(status) << " \"RegCloseKey\" failed.";
+            DD_LOG_CH(winapi, error) << w_api.getErrorString(status) << " \"RegCloseKey\" failed.";
           }
         })
       };
@@ -241,7 +241,7 @@ namespace display_device {
       DWORD required_size_in_bytes { 0 };
       auto status { RegQueryValueExW(reg_key, L"EDID", nullptr, nullptr, nullptr, &required_size_in_bytes) };
       if (status != ERROR_SUCCESS) {
-        DD_LOG(error) << w_api.getErrorString(status) << " \"RegQueryValueExW\" failed when getting size.";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(status) << " \"RegQueryValueExW\" failed when getting size.";
         return false;
       }
 
@@ -249,7 +249,7 @@ namespace display_device {
 
       status = RegQueryValueExW(reg_key, L"EDID", nullptr, nullptr, edid.data(), &required_size_in_bytes);
       if (status != ERROR_SUCCESS) {
-        DD_LOG(error) << w_api.getErrorString(status) << " \"RegQueryValueExW\" failed when getting data.";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(status) << " \"RegQueryValueExW\" failed when getting data.";
         return false;
       }
 
@@ -272,7 +272,7 @@ namespace display_device {
       // Get the output size required to store the string
       auto output_size = WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, value.data(), static_cast<int>(value.size()), nullptr, 0, nullptr, nullptr);
       if (output_size == 0) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " failed to get UTF-8 buffer size.";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " failed to get UTF-8 buffer size.";
         return {};
       }
 
@@ -280,7 +280,7 @@ namespace display_device {
       std::string output(output_size, '\0');
       output_size = WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, value.data(), static_cast<int>(value.size()), output.data(), static_cast<int>(output.size()), nullptr, nullptr);
       if (output_size == 0) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " failed to convert string to UTF-8.";
+        DD_LOG_CH(winapi, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " failed to convert string to UTF-8.";
         return {};
       }
 
@@ -336,7 +336,7 @@ namespace display_device {
 
       result = GetDisplayConfigBufferSizes(flags, &path_count, &mode_count);
       if (result != ERROR_SUCCESS) {
-        DD_LOG(error) << getErrorString(result) << " failed to get display paths and modes!";
+        DD_LOG_CH(winapi, error) << getErrorString(result) << " failed to get display paths and modes!";
         return std::nullopt;
       }
 
@@ -353,12 +353,19 @@ namespace display_device {
     } while (result == ERROR_INSUFFICIENT_BUFFER);
 
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to query display paths and modes!";
+      DD_LOG_CH(winapi, error) << getErrorString(result) << " failed to query display paths and modes!";
       return std::nullopt;
     }
 
-    DD_LOG(verbose) << "Result of " << (type == QueryType::Active ? "ACTIVE" : "ALL") << " display config query:\n"
-                    << dumpPathsAndModes(paths, modes) << "\n";
+    // Separate call sites, so that the ACTIVE and ALL results are each compared with their own previous result
+    if (type == QueryType::Active) {
+      DD_LOG_CH(winapi, verbose) << "Result of ACTIVE display config query:\n"
+                                 << DD_LOG_DEDUP(dumpPathsAndModes(paths, modes)) << "\n";
+    }
+    else {
+      DD_LOG_CH(winapi, verbose) << "Result of ALL display config query:\n"
+                                 << DD_LOG_DEDUP(dumpPathsAndModes(paths, modes)) << "\n";
+    }
     return PathAndModeData { paths, modes };
   }
 
@@ -378,7 +385,7 @@ namespace display_device {
       const auto dev_info_handle_cleanup {
         boost::scope::scope_exit([this, &dev_info_handle]() {
           if (!SetupDiDestroyDeviceInfoList(dev_info_handle)) {
-            DD_LOG(error) << getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiDestroyDeviceInfoList\" failed.";
+            DD_LOG_CH(winapi, error) << getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiDestroyDeviceInfoList\" failed.";
           }
         })
       };
@@ -392,7 +399,7 @@ namespace display_device {
             break;
           }
 
-          DD_LOG(warning) << getErrorString(static_cast<LONG>(error_code)) << " \"SetupDiEnumDeviceInterfaces\" failed.";
+          DD_LOG_CH(winapi, warning) << getErrorString(static_cast<LONG>(error_code)) << " \"SetupDiEnumDeviceInterfaces\" failed.";
           continue;
         }
 
@@ -440,13 +447,13 @@ namespace display_device {
         }
 
         if (unstable_part_index == std::wstring::npos) {
-          DD_LOG(error) << "Failed to split off the stable part from instance id string " << toUtf8(*this, instance_id);
+          DD_LOG_CH(winapi, error) << "Failed to split off the stable part from instance id string " << toUtf8(*this, instance_id);
           break;
         }
 
         auto semi_stable_part_index = instance_id.find_first_of(L'&', unstable_part_index + 1);
         if (semi_stable_part_index == std::wstring::npos) {
-          DD_LOG(error) << "Failed to split off the semi-stable part from instance id string " << toUtf8(*this, instance_id);
+          DD_LOG_CH(winapi, error) << "Failed to split off the semi-stable part from instance id string " << toUtf8(*this, instance_id);
           break;
         }
 
@@ -474,14 +481,14 @@ namespace display_device {
 
           return output.str();
         } };
-        DD_LOG(verbose) << "Creating device id from EDID + instance ID: " << dump_device_id_data(device_id_data);
+        DD_LOG_CH(winapi, verbose) << "Creating device id from EDID + instance ID: " << dump_device_id_data(device_id_data);
         break;
       }
     }
 
     if (device_id_data.empty()) {
       // Using the device path as a fallback, which is always unique, but not as stable as the preferred one
-      DD_LOG(verbose) << "Creating device id from path " << toUtf8(*this, device_path);
+      DD_LOG_CH(winapi, verbose) << "Creating device id from path " << toUtf8(*this, device_path);
       device_id_data.insert(std::end(device_id_data),
         reinterpret_cast<const BYTE *>(device_path.data()),
         reinterpret_cast<const BYTE *>(device_path.data() + device_path.size()));
@@ -491,7 +498,7 @@ namespace display_device {
     const auto boost_uuid { boost::uuids::name_generator_sha1 { ns_id }(device_id_data.data(), device_id_data.size()) };
     const std::string device_id { "{" + boost::uuids::to_string(boost_uuid) + "}" };
 
-    DD_LOG(verbose) << "Created device id: " << toUtf8(*this, device_path) << " -> " << device_id;
+    DD_LOG_CH(winapi, verbose) << "Created device id: " << toUtf8(*this, device_path) << " -> " << device_id;
     return device_id;
   }
 
@@ -510,7 +517,7 @@ namespace display_device {
 
     LONG result { DisplayConfigGetDeviceInfo(&target_name.header) };
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to get target device name!";
+      DD_LOG_CH(winapi, error) << getErrorString(result) << " failed to get target device name!";
       return {};
     }
 
@@ -527,7 +534,7 @@ namespace display_device {
 
     LONG result { DisplayConfigGetDeviceInfo(&source_name.header) };
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to get display name!";
+      DD_LOG_CH(winapi, error) << getErrorString(result) << " failed to get display name!";
       return {};
     }
 
@@ -555,7 +562,7 @@ namespace display_device {
 
     LONG result { DisplayConfigGetDeviceInfo(&color_info.header) };
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to get advanced color info!";
+      DD_LOG_CH(winapi, error) << getErrorString(result) << " failed to get advanced color info!";
       return std::nullopt;
     }
 
@@ -573,7 +580,7 @@ namespace display_device {
 
     LONG result { DisplayConfigSetDeviceInfo(&color_state.header) };
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to set advanced color info!";
+      DD_LOG_CH(winapi, error) << getErrorString(result) << " failed to set advanced color info!";
       return false;
     }
 
@@ -595,7 +602,7 @@ namespace display_device {
       if (data == nullptr)
       {
         // Sanity check
-        DD_LOG(error) << "EnumData is a nullptr!";
+        DD_LOG_CH(winapi, error) << "EnumData is a nullptr!";
         return FALSE;
       }
 
@@ -612,12 +619,12 @@ namespace display_device {
       return TRUE; }, reinterpret_cast<LPARAM>(&enum_data));
 
     if (!enum_data.m_width) {
-      DD_LOG(error) << "Failed to get monitor info for " << display_name << "!";
+      DD_LOG_CH(winapi, error) << "Failed to get monitor info for " << display_name << "!";
       return std::nullopt;
     }
 
     if (*enum_data.m_width * source_mode.width == 0) {
-      DD_LOG(error) << "Cannot get display scale for " << display_name << " from a width of 0!";
+      DD_LOG_CH(winapi, error) << "Cannot get display scale for " << display_name << " from a width of 0!";
       return std::nullopt;
     }
 
@@ -21,7 +21,7 @@ namespace display_device {
   WinDisplayDevice::isApiAccessAvailable() const {
     const auto display_data { m_w_api->queryDisplayConfig(QueryType::All) };
     if (!display_data) {
-      DD_LOG(debug) << "WinDisplayDevice::isApiAccessAvailable failed while querying display data.";
+      DD_LOG_CH(display, debug) << "WinDisplayDevice::isApiAccessAvailable failed while querying display data.";
       return false;
     }
 
@@ -31,7 +31,7 @@ namespace display_device {
     const UINT32 flags { SDC_VALIDATE | SDC_USE_SUPPLIED_DISPLAY_CONFIG | SDC_VIRTUAL_MODE_AWARE };
     const LONG result { m_w_api->setDisplayConfig(display_data->m_paths, display_data->m_modes, flags) };
 
-    DD_LOG(debug) << "WinDisplayDevice::isApiAccessAvailable result: " << m_w_api->getErrorString(result);
+    DD_LOG_CH(display, debug) << "WinDisplayDevice::isApiAccessAvailable result: " << m_w_api->getErrorString(result);
     return result == ERROR_SUCCESS;
   }
 
@@ -59,7 +59,7 @@ namespace display_device {
       const auto display_name { is_active ? m_w_api->getDisplayName(best_path) : std::string {} };  // Inactive devices can have multiple display names, so it's just meaningless use any
 
       if (is_active && !source_mode) {
-        DD_LOG(warning) << "Device " << device_id << " is missing source mode!";
+        DD_LOG_CH(display, warning) << "Device " << device_id << " is missing source mode!";
       }
 
       if (source_mode) {
@@ -109,14 +109,14 @@ namespace display_device {
     const auto path { win_utils::getActivePath(*m_w_api, device_id, display_data->m_paths) };
     if (!path) {
       // Debug level, because inactive device is valid case for this function
-      DD_LOG(debug) << "Failed to find device for " << device_id << "!";
+      DD_LOG_CH(display, debug) << "Failed to find device for " << device_id << "!";
       return {};
     }
 
     const auto display_name { m_w_api->getDisplayName(*path) };
     if (display_name.empty()) {
       // Theoretically possible due to some race condition in the OS...
-      DD_LOG(error) << "Device " << device_id << " has no display name assigned.";
+      DD_LOG_CH(display, error) << "Device " << device_id << " has no display name assigned.";
     }
 
     return display_name;
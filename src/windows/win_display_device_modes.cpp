@@ -38,13 +38,13 @@ namespace display_device {
       for (const auto &[device_id, mode] : modes) {
         const auto path { win_utils::getActivePath(w_api, device_id, display_data->m_paths) };
         if (!path) {
-          DD_LOG(error) << "Failed to find device for " << device_id << "!";
+          DD_LOG_CH(display, error) << "Failed to find device for " << device_id << "!";
           return false;
         }
 
         const auto source_mode { win_utils::getSourceMode(win_utils::getSourceIndex(*path, display_data->m_modes), display_data->m_modes) };
         if (!source_mode) {
-          DD_LOG(error) << "Active device does not have a source mode: " << device_id << "!";
+          DD_LOG_CH(display, error) << "Active device does not have a source mode: " << device_id << "!";
           return false;
         }
 
@@ -82,7 +82,7 @@ namespace display_device {
       }
 
       if (!changes_applied) {
-        DD_LOG(debug) << "No changes were made to display modes as they are equal.";
+        DD_LOG_CH(display, debug) << "No changes were made to display modes as they are equal.";
         return true;
       }
 
@@ -96,7 +96,7 @@ namespace display_device {
 
       const LONG result { w_api.setDisplayConfig(display_data->m_paths, display_data->m_modes, flags) };
       if (result != ERROR_SUCCESS) {
-        DD_LOG(error) << w_api.getErrorString(result) << " failed to set display mode!";
+        DD_LOG_CH(display, error) << w_api.getErrorString(result) << " failed to set display mode!";
         return false;
       }
 
@@ -107,7 +107,7 @@ namespace display_device {
   DeviceDisplayModeMap
   WinDisplayDevice::getCurrentDisplayModes(const std::set<std::string> &device_ids) const {
     if (device_ids.empty()) {
-      DD_LOG(error) << "Device id set is empty!";
+      DD_LOG_CH(display, error) << "Device id set is empty!";
       return {};
     }
 
@@ -120,19 +120,19 @@ namespace display_device {
     DeviceDisplayModeMap current_modes;
     for (const auto &device_id : device_ids) {
       if (device_id.empty()) {
-        DD_LOG(error) << "Device id is empty!";
+        DD_LOG_CH(display, error) << "Device id is empty!";
         return {};
       }
 
       const auto path { win_utils::getActivePath(*m_w_api, device_id, display_data->m_paths) };
       if (!path) {
-        DD_LOG(error) << "Failed to find device for " << device_id << "!";
+        DD_LOG_CH(display, error) << "Failed to find device for " << device_id << "!";
         return {};
       }
 
       const auto source_mode { win_utils::getSourceMode(win_utils::getSourceIndex(*path, display_data->m_modes), display_data->m_modes) };
       if (!source_mode) {
-        DD_LOG(error) << "Active device does not have a source mode: " << device_id << "!";
+        DD_LOG_CH(display, error) << "Active device does not have a source mode: " << device_id << "!";
         return {};
       }
 
@@ -150,7 +150,7 @@ namespace display_device {
   bool
   WinDisplayDevice::setDisplayModes(const DeviceDisplayModeMap &modes) {
     if (modes.empty()) {
-      DD_LOG(error) << "Modes map is empty!";
+      DD_LOG_CH(display, error) << "Modes map is empty!";
       return false;
     }
 
@@ -171,12 +171,12 @@ namespace display_device {
     const std::set<std::string> device_ids { std::begin(keys_view), std::end(keys_view) };
     const auto all_device_ids { win_utils::getAllDeviceIdsAndMatchingDuplicates(*m_w_api, device_ids) };
     if (all_device_ids.empty()) {
-      DD_LOG(error) << "Failed to get all duplicated devices!";
+      DD_LOG_CH(display, error) << "Failed to get all duplicated devices!";
       return false;
     }
 
     if (all_device_ids.size() != device_ids.size()) {
-      DD_LOG(error) << "Not all modes for duplicate displays were provided!";
+      DD_LOG_CH(display, error) << "Not all modes for duplicate displays were provided!";
       return false;
     }
 
@@ -223,7 +223,7 @@ namespace display_device {
       // which is not exposed to the via Windows settings app. To allow this
       // resolution to be selected, we actually need to omit SDC_ALLOW_CHANGES
       // flag.
-      DD_LOG(info) << "Failed to change display modes using Windows recommended modes, trying to set modes more strictly!";
+      DD_LOG_CH(display, info) << "Failed to change display modes using Windows recommended modes, trying to set modes more strictly!";
       if (doSetModes(*m_w_api, modes, Strategy::Strict)) {
         current_modes = getCurrentDisplayModes(device_ids);
         if (!current_modes.empty() && all_modes_match(current_modes)) {
@@ -234,7 +234,7 @@ namespace display_device {
 
     const UINT32 flags { SDC_APPLY | SDC_USE_SUPPLIED_DISPLAY_CONFIG | SDC_SAVE_TO_DATABASE | SDC_VIRTUAL_MODE_AWARE };
     static_cast<void>(m_w_api->setDisplayConfig(original_data->m_paths, original_data->m_modes, flags));  // Return value does not matter as we are trying out best to undo
-    DD_LOG(error) << "Failed to set display mode(-s) completely!";
+    DD_LOG_CH(display, error) << "Failed to set display mode(-s) completely!";
     return false;
   }
 }  // namespace display_device
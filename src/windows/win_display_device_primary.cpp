@@ -13,7 +13,7 @@ namespace display_device {
   bool
   WinDisplayDevice::isPrimary(const std::string &device_id) const {
     if (device_id.empty()) {
-      DD_LOG(error) << "Device id is empty!";
+      DD_LOG_CH(display, error) << "Device id is empty!";
       return false;
     }
 
@@ -25,13 +25,13 @@ namespace display_device {
 
     const auto path { win_utils::getActivePath(*m_w_api, device_id, display_data->m_paths) };
     if (!path) {
-      DD_LOG(error) << "Failed to find active device for " << device_id << "!";
+      DD_LOG_CH(display, error) << "Failed to find active device for " << device_id << "!";
       return false;
     }
 
     const auto source_mode { win_utils::getSourceMode(win_utils::getSourceIndex(*path, display_data->m_modes), display_data->m_modes) };
     if (!source_mode) {
-      DD_LOG(error) << "Active device does not have a source mode: " << device_id << "!";
+      DD_LOG_CH(display, error) << "Active device does not have a source mode: " << device_id << "!";
       return false;
     }
 
@@ -41,7 +41,7 @@ namespace display_device {
   bool
   WinDisplayDevice::setAsPrimary(const std::string &device_id) {
     if (device_id.empty()) {
-      DD_LOG(error) << "Device id is empty!";
+      DD_LOG_CH(display, error) << "Device id is empty!";
       return false;
     }
 
@@ -56,18 +56,18 @@ namespace display_device {
     {
       const auto path { win_utils::getActivePath(*m_w_api, device_id, display_data->m_paths) };
       if (!path) {
-        DD_LOG(error) << "Failed to find device for " << device_id << "!";
+        DD_LOG_CH(display, error) << "Failed to find device for " << device_id << "!";
         return false;
       }
 
       const auto source_mode { win_utils::getSourceMode(win_utils::getSourceIndex(*path, display_data->m_modes), display_data->m_modes) };
       if (!source_mode) {
-        DD_LOG(error) << "Active device does not have a source mode: " << device_id << "!";
+        DD_LOG_CH(display, error) << "Active device does not have a source mode: " << device_id << "!";
         return false;
       }
 
       if (win_utils::isPrimary(*source_mode)) {
-        DD_LOG(debug) << "Device " << device_id << " is already a primary device.";
+        DD_LOG_CH(display, debug) << "Device " << device_id << " is already a primary device.";
         return true;
       }
 
@@ -83,13 +83,13 @@ namespace display_device {
       auto source_mode { win_utils::getSourceMode(source_index, display_data->m_modes) };
 
       if (!source_index || !source_mode) {
-        DD_LOG(error) << "Active device does not have a source mode: " << current_id << "!";
+        DD_LOG_CH(display, error) << "Active device does not have a source mode: " << current_id << "!";
         return false;
       }
 
       if (modified_modes.find(*source_index) != std::end(modified_modes)) {
         // Happens when VIRTUAL_MODE_AWARE is not specified when querying paths, probably will never happen in our (since it's always set), but just to be safe...
-        DD_LOG(debug) << "Device " << current_id << " shares the same mode index as a previous device. Device is duplicated. Skipping.";
+        DD_LOG_CH(display, debug) << "Device " << current_id << " shares the same mode index as a previous device. Device is duplicated. Skipping.";
         continue;
       }
 
@@ -102,7 +102,7 @@ namespace display_device {
     const UINT32 flags { SDC_APPLY | SDC_USE_SUPPLIED_DISPLAY_CONFIG | SDC_SAVE_TO_DATABASE | SDC_VIRTUAL_MODE_AWARE };
     const LONG result { m_w_api->setDisplayConfig(display_data->m_paths, display_data->m_modes, flags) };
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << m_w_api->getErrorString(result) << " failed to set primary mode for " << device_id << "!";
+      DD_LOG_CH(display, error) << m_w_api->getErrorString(result) << " failed to set primary mode for " << device_id << "!";
       return false;
     }
 
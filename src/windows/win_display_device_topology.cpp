@@ -35,17 +35,17 @@ namespace display_device {
       UINT32 flags { SDC_APPLY | SDC_TOPOLOGY_SUPPLIED | SDC_ALLOW_PATH_ORDER_CHANGES | SDC_VIRTUAL_MODE_AWARE };
       LONG result { w_api.setDisplayConfig(paths, {}, flags) };
       if (result == ERROR_GEN_FAILURE) {
-        DD_LOG(warning) << w_api.getErrorString(result) << " failed to change topology using the topology from Windows DB! Asking Windows to create the topology.";
+        DD_LOG_CH(display, warning) << w_api.getErrorString(result) << " failed to change topology using the topology from Windows DB! Asking Windows to create the topology.";
 
         flags = SDC_APPLY | SDC_USE_SUPPLIED_DISPLAY_CONFIG | SDC_ALLOW_CHANGES /* This flag is probably not needed, but who knows really... (not MSDOCS at least) */ | SDC_VIRTUAL_MODE_AWARE | SDC_SAVE_TO_DATABASE;
         result = w_api.setDisplayConfig(paths, {}, flags);
         if (result != ERROR_SUCCESS) {
-          DD_LOG(error) << w_api.getErrorString(result) << " failed to create new topology configuration!";
+          DD_LOG_CH(display, error) << w_api.getErrorString(result) << " failed to create new topology configuration!";
           return false;
         }
       }
       else if (result != ERROR_SUCCESS) {
-        DD_LOG(error) << w_api.getErrorString(result) << " failed to change topology configuration!";
+        DD_LOG_CH(display, error) << w_api.getErrorString(result) << " failed to change topology configuration!";
         return false;
       }
 
@@ -74,7 +74,7 @@ namespace display_device {
 
       const auto source_mode { win_utils::getSourceMode(win_utils::getSourceIndex(path, display_data->m_modes), display_data->m_modes) };
       if (!source_mode) {
-        DD_LOG(error) << "Active device does not have a source mode: " << device_info->m_device_id << "!";
+        DD_LOG_CH(display, error) << "Active device does not have a source mode: " << device_info->m_device_id << "!";
         return {};
       }
 
@@ -96,7 +96,7 @@ namespace display_device {
   bool
   WinDisplayDevice::isTopologyValid(const ActiveTopology &topology) const {
     if (topology.empty()) {
-      DD_LOG(warning) << "Topology input is empty!";
+      DD_LOG_CH(display, warning) << "Topology input is empty!";
       return false;
     }
 
@@ -106,13 +106,13 @@ namespace display_device {
       // You CAN set the group to be more than 2, but then
       // Windows' settings app breaks since it was not designed for this :/
       if (group.empty() || group.size() > 2) {
-        DD_LOG(warning) << "Topology group is invalid!";
+        DD_LOG_CH(display, warning) << "Topology group is invalid!";
         return false;
       }
 
       for (const auto &device_id : group) {
         if (!device_ids.insert(device_id).second) {
-          DD_LOG(warning) << "Duplicate device ids found in topology!";
+          DD_LOG_CH(display, warning) << "Duplicate device ids found in topology!";
           return false;
         }
       }
@@ -144,18 +144,18 @@ namespace display_device {
   bool
   WinDisplayDevice::setTopology(const ActiveTopology &new_topology) {
     if (!isTopologyValid(new_topology)) {
-      DD_LOG(error) << "Topology input is invalid!";
+      DD_LOG_CH(display, error) << "Topology input is invalid!";
       return false;
     }
 
     const auto current_topology { getCurrentTopology() };
     if (!isTopologyValid(current_topology)) {
-      DD_LOG(error) << "Failed to get current topology!";
+      DD_LOG_CH(display, error) << "Failed to get current topology!";
       return false;
     }
 
     if (isTopologyTheSame(current_topology, new_topology)) {
-      DD_LOG(debug) << "Same topology provided.";
+      DD_LOG_CH(display, debug) << "Same topology provided.";
       return true;
     }
 
@@ -196,11 +196,11 @@ namespace display_device {
           //
           // However, since we have this bug an additional sanity check is needed
           // regardless of what Windows report back to us.
-          DD_LOG(error) << "Failed to change topology due to Windows bug or because the display is in deep sleep!";
+          DD_LOG_CH(display, error) << "Failed to change topology due to Windows bug or because the display is in deep sleep!";
         }
       }
       else {
-        DD_LOG(error) << "Failed to get updated topology!";
+        DD_LOG_CH(display, error) << "Failed to get updated topology!";
       }
 
       // Revert back to the original topology
@@ -0,0 +1,189 @@
+// system includes
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <sstream>
+
+// local includes
+#include "display_device/logging.h"
+
+namespace {
+  /**
+   * @brief A stream buffer that discards everything, so that the default sink cost excludes the terminal.
+   */
+  class NullStreamBuffer: public std::streambuf {
+  protected:
+    int
+    overflow(int value) override {
+      return value;
+    }
+
+    std::streamsize
+    xsputn(const char *, std::streamsize count) override {
+      return count;
+    }
+  };
+
+  /**
+   * @brief Configure the logger for the benchmark and restore the defaults afterwards.
+   */
+  class LoggerSetup {
+  public:
+    explicit LoggerSetup(const display_device::Logger::LogLevel log_level, display_device::Logger::Callback callback = nullptr):
+        m_sbuf { std::cout.rdbuf(&m_null_buffer) } {
+      display_device::Logger::get().setLogLevel(log_level);
+      display_device::Logger::get().setCustomCallback(std::move(callback));
+    }
+
+    ~LoggerSetup() {
+      display_device::Logger::get().setCustomCallback(nullptr);
+      display_device::Logger::get().setLogLevel(display_device::Logger::LogLevel::info);
+      std::cout.rdbuf(m_sbuf);
+    }
+
+    LoggerSetup(const LoggerSetup &) = delete;
+    LoggerSetup &
+    operator=(const LoggerSetup &) = delete;
+
+  private:
+    NullStreamBuffer m_null_buffer;
+    std::streambuf *m_sbuf;
+  };
+
+  /**
+   * @brief A typical log statement with a few values.
+   */
+  void
+  logSomething(const int value) {
+    DD_LOG(info) << "Some message with a value: " << value << ", a flag: " << true << " and a string: " << std::string_view { "some string" };
+  }
+
+  void
+  BM_Log_Disabled(benchmark::State &state) {
+    const LoggerSetup setup { display_device::Logger::LogLevel::error };
+    int value { 0 };
+    for (auto _ : state) {
+      logSomething(value++);
+    }
+  }
+
+  void
+  BM_Log_DefaultSink(benchmark::State &state) {
+    const LoggerSetup setup { display_device::Logger::LogLevel::info };
+    int value { 0 };
+    for (auto _ : state) {
+      logSomething(value++);
+    }
+  }
+
+  void
+  BM_Log_CustomCallback(benchmark::State &state) {
+    const LoggerSetup setup { display_device::Logger::LogLevel::info, [](auto, std::string_view value) {
+                               benchmark::DoNotOptimize(value.data());
+                             } };
+    int value { 0 };
+    for (auto _ : state) {
+      logSomething(value++);
+    }
+  }
+
+  /**
+   * @brief A debug statement, which is below the output level in the flight recorder benchmarks.
+   */
+  void
+  logSomethingAtDebug(const int value) {
+    DD_LOG(debug) << "Some message with a value: " << value << ", a flag: " << true << " and a string: " << std::string_view { "some string" };
+  }
+
+  void
+  BM_Log_Disabled_Debug(benchmark::State &state) {
+    const LoggerSetup setup { display_device::Logger::LogLevel::info };
+    int value { 0 };
+    for (auto _ : state) {
+      logSomethingAtDebug(value++);
+    }
+  }
+
+  void
+  BM_Log_FlightRecorder(benchmark::State &state) {
+    const LoggerSetup setup { display_device::Logger::LogLevel::info };
+    display_device::Logger::get().enableFlightRecorder({ .m_capture_level = display_device::Logger::LogLevel::debug, .m_dump_on_error = false });
+
+    int value { 0 };
+    for (auto _ : state) {
+      logSomethingAtDebug(value++);
+    }
+
+    display_device::Logger::get().disableFlightRecorder();
+  }
+
+  void
+  BM_Log_DefaultSink_Contention(benchmark::State &state) {
+    // All the threads are synchronized before the first and after the last iteration,
+    // so the logger is configured only once by the first thread.
+    std::optional<LoggerSetup> setup;
+    if (state.thread_index() == 0) {
+      setup.emplace(display_device::Logger::LogLevel::info);
+    }
+
+    int value { 0 };
+    for (auto _ : state) {
+      logSomething(value++);
+    }
+  }
+
+  /**
+   * @brief The timestamp prefix formatting without any caching, as it used to be done
+   *        by the default log output (kept for comparison).
+   */
+  void
+  appendLogTimestampWithPutTime(std::string &output, const std::chrono::system_clock::time_point timestamp) {
+    std::stringstream stream;
+    const auto now_ms { std::chrono::duration_cast<std::chrono::milliseconds>(timestamp.time_since_epoch()) };
+    const auto now_s { std::chrono::duration_cast<std::chrono::seconds>(now_ms) };
+
+    const std::time_t time { std::chrono::system_clock::to_time_t(timestamp) };
+    std::tm localtime {};
+#if defined(_MSC_VER)
+    localtime_s(&localtime, &time);
+#else
+    localtime_r(&time, &localtime);
+#endif
+    const auto now_decimal_part { now_ms - now_s };
+
+    stream << std::put_time(&localtime, "[%Y-%m-%d %H:%M:%S.") << std::setfill('0') << std::setw(3) << now_decimal_part.count() << "] ";
+    output += stream.str();
+  }
+
+  void
+  BM_LogTimestamp_PutTime(benchmark::State &state) {
+    std::string output;
+    for (auto _ : state) {
+      output.clear();
+      appendLogTimestampWithPutTime(output, std::chrono::system_clock::now());
+      benchmark::DoNotOptimize(output.data());
+    }
+  }
+
+  void
+  BM_LogTimestamp_Cached(benchmark::State &state) {
+    std::string output;
+    for (auto _ : state) {
+      output.clear();
+      display_device::detail::appendLogTimestamp(output, std::chrono::system_clock::now());
+      benchmark::DoNotOptimize(output.data());
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_Log_Disabled);
+BENCHMARK(BM_Log_DefaultSink);
+BENCHMARK(BM_Log_CustomCallback);
+BENCHMARK(BM_Log_Disabled_Debug);
+BENCHMARK(BM_Log_FlightRecorder);
+BENCHMARK(BM_Log_DefaultSink_Contention)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LogTimestamp_PutTime);
+BENCHMARK(BM_LogTimestamp_Cached);
@@ -0,0 +1,196 @@
+// system includes
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+  #include <ctime>
+#endif
+
+// local includes
+#include "display_device/retry_scheduler.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  /**
+   * @brief A fake interface that only keeps some state for the callbacks to touch.
+   */
+  struct FakeIface {
+    std::uint64_t m_queries { 0 };
+    std::uint64_t m_retries { 0 };
+  };
+
+  using Scheduler = display_device::RetryScheduler<FakeIface>;
+
+  /**
+   * @brief Keep the CPU busy for the duration (sleeping would hide the lock hold time).
+   */
+  void
+  busyWait(const std::chrono::microseconds duration) {
+    const auto deadline { std::chrono::steady_clock::now() + duration };
+    while (std::chrono::steady_clock::now() < deadline) {
+      // Busy waiting
+    }
+  }
+
+  /**
+   * @brief Create the sleep policy by the benchmark argument.
+   */
+  display_device::BackoffPolicy
+  makePolicy(const std::int64_t policy_index, const std::chrono::milliseconds interval) {
+    switch (policy_index) {
+      case 1:
+        return display_device::ExponentialBackoff { interval, interval * 4 };
+      case 2:
+        // Fixed seed, so that the callback can follow the same sequence
+        return display_device::DecorrelatedJitterBackoff { interval, interval * 4, 42 };
+      default:
+        return display_device::FixedBackoff { interval };
+    }
+  }
+
+  /**
+   * @brief Get the value at the percentile of the sorted values.
+   */
+  double
+  getPercentile(const std::vector<double> &sorted_values, const double percentile) {
+    if (sorted_values.empty()) {
+      return 0.0;
+    }
+
+    const auto index { static_cast<std::size_t>(percentile / 100.0 * static_cast<double>(sorted_values.size() - 1)) };
+    return sorted_values[index];
+  }
+
+  /**
+   * @brief Scheduler with a high-frequency callback that measures how late it runs compared to the requested sleep.
+   */
+  class ScheduledCallbackSetup {
+  public:
+    ScheduledCallbackSetup(const std::chrono::microseconds callback_duration, const std::chrono::milliseconds interval, const std::int64_t policy_index):
+        m_expected_policy { makePolicy(policy_index, interval) } {
+      m_previous_end = std::chrono::steady_clock::now();
+      m_scheduler.schedule([this, callback_duration](FakeIface &iface, auto &) {
+        const auto started_at { std::chrono::steady_clock::now() };
+        const auto expected_at { m_previous_end + display_device::takeNextDuration(m_expected_policy) };
+        m_jitter_us.push_back(std::chrono::duration<double, std::micro>(started_at - expected_at).count());
+
+        busyWait(callback_duration);
+        iface.m_retries++;
+        m_previous_end = std::chrono::steady_clock::now();
+      },
+        { .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly, .m_backoff_policy = makePolicy(policy_index, interval) });
+    }
+
+    /**
+     * @brief Stop the callback and get the sorted jitter values.
+     */
+    std::vector<double>
+    stopAndGetJitter() {
+      m_scheduler.stop();
+      std::ranges::sort(m_jitter_us);
+      return m_jitter_us;
+    }
+
+    Scheduler &
+    getScheduler() {
+      return m_scheduler;
+    }
+
+  private:
+    display_device::BackoffPolicy m_expected_policy;
+    std::chrono::steady_clock::time_point m_previous_end;
+    std::vector<double> m_jitter_us;
+    Scheduler m_scheduler { std::make_unique<FakeIface>() };  // Last, so that the callback is stopped first
+  };
+
+  /**
+   * @brief Threads calling `execute` while the scheduled callback runs at a high frequency.
+   *        Arguments: callback duration (us), interval (ms) and policy (0 - fixed, 1 - exponential, 2 - decorrelated jitter).
+   */
+  void
+  BM_RetryScheduler_ExecuteContention(benchmark::State &state) {
+    // All the threads are synchronized before the first and after the last iteration,
+    // so the scheduler is created only once by the first thread.
+    static std::unique_ptr<ScheduledCallbackSetup> setup;
+    if (state.thread_index() == 0) {
+      setup = std::make_unique<ScheduledCallbackSetup>(std::chrono::microseconds { state.range(0) }, std::chrono::milliseconds { state.range(1) }, state.range(2));
+    }
+
+    std::vector<double> latencies_us;
+    for (auto _ : state) {
+      const auto started_at { std::chrono::steady_clock::now() };
+      const auto queries { setup->getScheduler().execute([](FakeIface &iface) { return ++iface.m_queries; }) };
+      latencies_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - started_at).count());
+      benchmark::DoNotOptimize(queries);
+    }
+
+    std::ranges::sort(latencies_us);
+    state.counters["execute_p50_us"] = benchmark::Counter(getPercentile(latencies_us, 50), benchmark::Counter::kAvgThreads);
+    state.counters["execute_p99_us"] = benchmark::Counter(getPercentile(latencies_us, 99), benchmark::Counter::kAvgThreads);
+    state.counters["execute_max_us"] = benchmark::Counter(latencies_us.empty() ? 0.0 : latencies_us.back(), benchmark::Counter::kAvgThreads);
+
+    if (state.thread_index() == 0) {
+      const auto jitter_us { setup->stopAndGetJitter() };
+      state.counters["callbacks"] = static_cast<double>(jitter_us.size());
+      state.counters["jitter_p50_us"] = getPercentile(jitter_us, 50);
+      state.counters["jitter_p99_us"] = getPercentile(jitter_us, 99);
+      setup.reset();
+    }
+  }
+
+  /**
+   * @brief CPU use of the (mostly) idle scheduler thread or the shared executor threads.
+   *        Arguments: interval (ms), policy (0 - fixed, 1 - exponential, 2 - decorrelated jitter)
+   *        and executor (0 - dedicated thread, 1 - shared executor).
+   */
+  void
+  BM_RetryScheduler_IdleCpu(benchmark::State &state) {
+#if defined(__linux__)
+    const auto get_cpu_time { []() {
+      timespec time {};
+      clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+      return std::chrono::seconds { time.tv_sec } + std::chrono::nanoseconds { time.tv_nsec };
+    } };
+
+    // The executor must outlive the scheduler
+    const auto executor { state.range(2) != 0 ? std::make_shared<display_device::SchedulerExecutor>() : nullptr };
+    const auto scheduler { executor ? std::make_unique<Scheduler>(std::make_unique<FakeIface>(), executor) : std::make_unique<Scheduler>(std::make_unique<FakeIface>()) };
+    scheduler->schedule([](FakeIface &iface, auto &) { iface.m_retries++; },
+      { .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly, .m_backoff_policy = makePolicy(state.range(1), std::chrono::milliseconds { state.range(0) }) });
+
+    // The calling thread is sleeping, so the process CPU time is spent by the scheduler (or executor) threads
+    std::chrono::nanoseconds cpu_time { 0 };
+    std::chrono::nanoseconds wall_time { 0 };
+    for (auto _ : state) {
+      const auto cpu_started_at { get_cpu_time() };
+      const auto wall_started_at { std::chrono::steady_clock::now() };
+      std::this_thread::sleep_for(100ms);
+      cpu_time += get_cpu_time() - cpu_started_at;
+      wall_time += std::chrono::steady_clock::now() - wall_started_at;
+    }
+
+    state.counters["scheduler_cpu_percent"] = wall_time.count() > 0 ? 100.0 * static_cast<double>(cpu_time.count()) / static_cast<double>(wall_time.count()) : 0.0;
+    state.counters["callbacks"] = static_cast<double>(scheduler->execute([](const FakeIface &iface) { return iface.m_retries; }));
+#else
+    state.SkipWithError("The process CPU time is only measured on Linux.");
+#endif
+  }
+}  // namespace
+
+BENCHMARK(BM_RetryScheduler_ExecuteContention)
+  ->ArgNames({ "callback_us", "interval_ms", "policy" })
+  ->ArgsProduct({ { 0, 100 }, { 1, 10 }, { 0, 1, 2 } })
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+BENCHMARK(BM_RetryScheduler_IdleCpu)
+  ->ArgNames({ "interval_ms", "policy", "executor" })
+  ->ArgsProduct({ { 1, 100, 1000 }, { 0, 1, 2 }, { 0, 1 } })
+  ->Iterations(10)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
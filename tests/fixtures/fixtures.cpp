@@ -30,7 +30,9 @@ BaseTest::TearDown() {
     return;
   }
 
-  // reset the callback to avoid potential leaks
+  // reset the logger to avoid potential leaks
+  display_device::Logger::get().disableAsync();
+  display_device::Logger::get().disableFlightRecorder();
   display_device::Logger::get().setCustomCallback(nullptr);
 
   // Restore cout buffer and print the suppressed output out in case we have failed :/
@@ -0,0 +1,93 @@
+// system includes
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+// local includes
+#include "display_device/logging.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Allocation counters for verifying the steady state of the logger
+  thread_local bool count_allocations { false };
+  thread_local int allocation_count { 0 };
+
+  // A stream buffer that discards everything without allocating
+  class NullStreamBuffer: public std::streambuf {
+  protected:
+    int
+    overflow(int value) override {
+      return value;
+    }
+
+    std::streamsize
+    xsputn(const char *, std::streamsize count) override {
+      return count;
+    }
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, LoggingTest, __VA_ARGS__)
+}  // namespace
+
+// Replaced global allocation functions that count the allocations (when requested) of the current thread
+void *
+operator new(std::size_t size) {
+  if (count_allocations) {
+    allocation_count++;
+  }
+
+  if (void *ptr { std::malloc(size == 0 ? 1 : size) }) {
+    return ptr;
+  }
+  throw std::bad_alloc {};
+}
+
+void
+operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void
+operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+TEST_S(NoAllocationsInSteadyState) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  const std::string long_string(256, 'x');
+  const auto log_and_count_allocations { [&long_string]() {
+    allocation_count = 0;
+    count_allocations = true;
+    DD_LOG(info) << "Hello World! " << 123 << ' ' << 1.5 << ' ' << long_string << std::string_view { " view" };
+    count_allocations = false;
+    return allocation_count;
+  } };
+
+  logger.setLogLevel(level::verbose);
+
+  std::size_t text_size { 0 };
+  logger.setCustomCallback([&text_size](auto, std::string_view value) {
+    text_size = value.size();
+  });
+  log_and_count_allocations();  // Warm up the buffers
+  EXPECT_EQ(log_and_count_allocations(), 0);
+  EXPECT_EQ(text_size, 282);
+
+  std::size_t record_count { 0 };
+  logger.setCustomRecordCallback([&record_count](const auto &) {
+    record_count++;
+  });
+  log_and_count_allocations();
+  EXPECT_EQ(log_and_count_allocations(), 0);
+  EXPECT_EQ(record_count, 2);
+
+  NullStreamBuffer null_buffer;
+  auto *const original_buffer { std::cout.rdbuf(&null_buffer) };
+  logger.setCustomCallback(nullptr);
+  log_and_count_allocations();
+  EXPECT_EQ(log_and_count_allocations(), 0);
+  std::cout.rdbuf(original_buffer);
+}
@@ -0,0 +1,58 @@
+// The minimum compiled in level must be raised before the logging header is included
+// (this replaces the `DD_LOG_MIN_LEVEL` value provided by the library target)
+#undef DD_LOG_MIN_LEVEL
+#define DD_LOG_MIN_LEVEL 2  // Logger::LogLevel::info
+
+// system includes
+#include <string>
+#include <vector>
+
+// local includes
+#include "display_device/logging.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, LoggingMinLevelTest, __VA_ARGS__)
+}  // namespace
+
+TEST_S(LevelsBelowTheFloorAreNotCompiledIn) {
+  using level = display_device::Logger::LogLevel;
+
+  static_assert(!display_device::Logger::isLogLevelCompiledIn(level::verbose));
+  static_assert(!display_device::Logger::isLogLevelCompiledIn(level::debug));
+  static_assert(display_device::Logger::isLogLevelCompiledIn(level::info));
+  static_assert(display_device::Logger::isLogLevelCompiledIn(level::warning));
+  static_assert(display_device::Logger::isLogLevelCompiledIn(level::error));
+  static_assert(display_device::Logger::isLogLevelCompiledIn(level::fatal));
+}
+
+TEST_S(StatementsBelowTheFloorAreNotEvaluated) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  int invocations { 0 };
+  const auto some_function { [&invocations](const std::string &value) {
+    invocations++;
+    return value;
+  } };
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string_view value) {
+    output.emplace_back(value);
+  });
+  logger.setLogLevel(level::verbose);
+
+  DD_LOG(verbose) << some_function("verbose");
+  DD_LOG(debug) << some_function("debug");
+  DD_LOG(debug) << DD_LOG_DEDUP(some_function("debug dedup"));
+  DD_LOG_CH(settings, verbose) << some_function("settings verbose");
+  DD_LOG(info) << some_function("info");
+  DD_LOG(warning) << some_function("warning");
+
+  EXPECT_EQ(invocations, 2);
+  EXPECT_EQ(output, (std::vector<std::string> { "info", "warning" }));
+
+  logger.setCustomCallback(nullptr);
+  logger.setLogLevel(level::info);
+}
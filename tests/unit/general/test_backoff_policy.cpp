@@ -0,0 +1,83 @@
+// system includes
+#include <gmock/gmock.h>
+
+// local includes
+#include "display_device/backoff_policy.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Helper functions
+  std::vector<std::chrono::milliseconds>
+  takeDurations(display_device::BackoffPolicy policy, const std::size_t count) {
+    std::vector<std::chrono::milliseconds> durations;
+    for (std::size_t i = 0; i < count; ++i) {
+      durations.push_back(display_device::takeNextDuration(policy));
+    }
+    return durations;
+  }
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, BackoffPolicy, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Fixed) {
+  EXPECT_EQ(takeDurations(display_device::FixedBackoff { 5ms }, 3), (std::vector { 5ms, 5ms, 5ms }));
+  EXPECT_THAT([]() { const display_device::FixedBackoff policy(0ms); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Duration must be larger than 0 in FixedBackoff!")));
+}
+
+TEST_S(Linear) {
+  EXPECT_EQ(takeDurations(display_device::LinearBackoff { 10ms, 5ms, 22ms }, 5), (std::vector { 10ms, 15ms, 20ms, 22ms, 22ms }));
+  EXPECT_EQ(takeDurations(display_device::LinearBackoff { 10ms, 0ms, 22ms }, 2), (std::vector { 10ms, 10ms }));
+  EXPECT_THAT([]() { const display_device::LinearBackoff policy(10ms, -1ms, 20ms); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Step must not be negative in LinearBackoff!")));
+}
+
+TEST_S(Exponential) {
+  EXPECT_EQ(takeDurations(display_device::ExponentialBackoff { 10ms, 50ms }, 5), (std::vector { 10ms, 20ms, 40ms, 50ms, 50ms }));
+  EXPECT_EQ(takeDurations(display_device::ExponentialBackoff { 10ms, 50ms, 1.5 }, 4), (std::vector { 10ms, 15ms, 22ms, 33ms }));
+  EXPECT_THAT([]() { const display_device::ExponentialBackoff policy(10ms, 20ms, 0.5); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Multiplier must not be smaller than 1 in ExponentialBackoff!")));
+}
+
+TEST_S(Exponential, NoOverflow) {
+  const auto max { std::chrono::milliseconds::max() };
+  const auto durations { takeDurations(display_device::ExponentialBackoff { 1ms, max, 1000.0 }, 10) };
+  EXPECT_EQ(durations.back(), max);
+  EXPECT_TRUE(std::ranges::is_sorted(durations));
+}
+
+TEST_S(DecorrelatedJitter) {
+  const auto durations { takeDurations(display_device::DecorrelatedJitterBackoff { 10ms, 100ms, 1234 }, 100) };
+  EXPECT_TRUE(std::ranges::all_of(durations, [](const auto &duration) { return duration >= 10ms && duration <= 100ms; }));
+
+  // Same seed, same sequence
+  EXPECT_EQ(durations, takeDurations(display_device::DecorrelatedJitterBackoff { 10ms, 100ms, 1234 }, 100));
+
+  // Every duration is bounded by the previous one
+  for (std::size_t i = 1; i < durations.size(); ++i) {
+    EXPECT_LE(durations[i], durations[i - 1] * 3);
+  }
+}
+
+TEST_S(List) {
+  EXPECT_EQ(takeDurations(display_device::ListBackoff { { 1ms, 2ms, 3ms } }, 5), (std::vector { 1ms, 2ms, 3ms, 3ms, 3ms }));
+  EXPECT_THAT([]() { const display_device::ListBackoff policy({}); },
+    ThrowsMessage<std::logic_error>(HasSubstr("At least 1 duration must be specified in ListBackoff!")));
+  EXPECT_THAT([]() { const display_device::ListBackoff policy({ 1ms, 0ms }); },
+    ThrowsMessage<std::logic_error>(HasSubstr("All of the durations specified in ListBackoff must be larger than a 0!")));
+}
+
+TEST_S(InvalidRange) {
+  EXPECT_THAT([]() { const display_device::LinearBackoff policy(0ms, 1ms, 20ms); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Initial duration must be larger than 0 in LinearBackoff!")));
+  EXPECT_THAT([]() { const display_device::ExponentialBackoff policy(20ms, 10ms); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Maximum duration must not be smaller than the initial duration in ExponentialBackoff!")));
+  EXPECT_THAT([]() { const display_device::DecorrelatedJitterBackoff policy(20ms, 10ms); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Maximum duration must not be smaller than the initial duration in DecorrelatedJitterBackoff!")));
+}
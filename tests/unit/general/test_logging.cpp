@@ -1,8 +1,28 @@
+// system includes
+#include <atomic>
+#include <filesystem>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <thread>
+
 // local includes
 #include "display_device/logging.h"
 #include "fixtures/fixtures.h"
 
 namespace {
+  using namespace std::chrono_literals;
+
+  // A type without the native log support, whose output depends on the stream flags
+  struct StreamedNumber {
+    int m_value;
+
+    friend std::ostream &
+    operator<<(std::ostream &stream, const StreamedNumber &number) {
+      return stream << number.m_value << ' ' << (number.m_value != 0);
+    }
+  };
+
   // Specialized TEST macro(s) for this test file
 #define TEST_S(...) DD_MAKE_TEST(TEST, LoggingTest, __VA_ARGS__)
 }  // namespace
@@ -119,8 +139,8 @@ TEST_S(CustomCallback) {
 
   std::string output;
   logger.setLogLevel(level::verbose);
-  logger.setCustomCallback([&output](const level level, const std::string &value) {
-    output = std::to_string(static_cast<level_t>(level)) + " " + value;
+  logger.setCustomCallback([&output](const level level, std::string_view value) {
+    output = std::to_string(static_cast<level_t>(level)) + " " + std::string { value };
   });
 
   logger.write(level::verbose, "Hello World!");
@@ -206,3 +226,508 @@ TEST_S(LogMacroDisablesStreamChain) {
   EXPECT_EQ(output_logged, true);
   EXPECT_EQ(some_function_invoked, true);
 }
+
+TEST_S(AsyncMode, EnableAndDisable) {
+  auto &logger { display_device::Logger::get() };
+
+  EXPECT_FALSE(logger.isAsyncEnabled());
+  logger.enableAsync({});
+  EXPECT_TRUE(logger.isAsyncEnabled());
+  logger.enableAsync({ .m_capacity = 1 });
+  EXPECT_TRUE(logger.isAsyncEnabled());
+  logger.disableAsync();
+  EXPECT_FALSE(logger.isAsyncEnabled());
+  logger.disableAsync();
+  EXPECT_FALSE(logger.isAsyncEnabled());
+}
+
+TEST_S(AsyncMode, DefaultLogger) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  logger.setLogLevel(level::verbose);
+  logger.enableAsync({});
+  logger.write(level::info, "Hello World!");
+  logger.flush();
+
+  EXPECT_TRUE(testRegex(m_cout_buffer.str(), R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    Hello World!\n)"));
+}
+
+TEST_S(AsyncMode, WrittenOnBackgroundThread) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  std::vector<std::pair<std::thread::id, std::string>> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, std::string_view value) {
+    output.emplace_back(std::this_thread::get_id(), value);
+  });
+
+  logger.enableAsync({});
+  for (int i = 0; i < 100; ++i) {
+    DD_LOG(info) << "Value " << i;
+  }
+  logger.flush();
+
+  ASSERT_EQ(output.size(), 100);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_NE(output[i].first, std::this_thread::get_id());
+    EXPECT_EQ(output[i].second, "Value " + std::to_string(i));
+  }
+}
+
+TEST_S(AsyncMode, MultipleProducers) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  constexpr int thread_count { 4 };
+  constexpr int record_count { 1000 };
+
+  std::vector<std::vector<int>> output(thread_count);
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, std::string_view value) {
+    const auto separator { value.find(' ') };
+    output[std::stoi(std::string { value.substr(0, separator) })].push_back(std::stoi(std::string { value.substr(separator + 1) }));
+  });
+
+  logger.enableAsync({ .m_capacity = 16 });
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+      threads.emplace_back([t]() {
+        for (int i = 0; i < record_count; ++i) {
+          DD_LOG(info) << t << " " << i;
+        }
+      });
+    }
+  }
+  logger.disableAsync();
+
+  for (const auto &values : output) {
+    ASSERT_EQ(values.size(), record_count);
+    for (int i = 0; i < record_count; ++i) {
+      EXPECT_EQ(values[i], i);
+    }
+  }
+}
+
+TEST_S(AsyncMode, FlushFromMultipleProducers) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  constexpr int thread_count { 4 };
+  constexpr int record_count { 1000 };
+
+  std::mutex output_mutex;
+  std::vector<std::vector<int>> output(thread_count);
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&](auto, std::string_view value) {
+    const auto separator { value.find(' ') };
+    std::lock_guard lock { output_mutex };
+    output[std::stoi(std::string { value.substr(0, separator) })].push_back(std::stoi(std::string { value.substr(separator + 1) }));
+  });
+
+  // Every record pushed by the thread must be written by the time its flush returns,
+  // even while the other threads are pushing at the same time
+  std::atomic<int> missing_records { 0 };
+  logger.enableAsync({ .m_capacity = 16 });
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+      threads.emplace_back([&, t]() {
+        for (int i = 0; i < record_count; ++i) {
+          DD_LOG(info) << t << " " << i;
+          logger.flush();
+
+          std::lock_guard lock { output_mutex };
+          if (output[t].empty() || output[t].back() != i) {
+            missing_records++;
+          }
+        }
+      });
+    }
+  }
+  logger.disableAsync();
+
+  EXPECT_EQ(missing_records, 0);
+  for (const auto &values : output) {
+    EXPECT_EQ(values.size(), record_count);
+  }
+}
+
+TEST_S(AsyncMode, OverflowPolicy) {
+  using level = display_device::Logger::LogLevel;
+  using policy = display_device::Logger::OverflowPolicy;
+  auto &logger { display_device::Logger::get() };
+
+  const auto write_with_full_queue { [&logger](const policy overflow_policy) {
+    std::vector<std::string> output;
+    std::atomic<bool> callback_entered { false };
+    std::atomic<bool> callback_released { false };
+    logger.setCustomCallback([&](auto, std::string_view value) {
+      callback_entered = true;
+      callback_entered.notify_all();
+      callback_released.wait(false);
+      output.emplace_back(value);
+    });
+
+    logger.enableAsync({ .m_capacity = 2, .m_overflow_policy = overflow_policy });
+    logger.write(level::info, "0");
+    callback_entered.wait(false);
+
+    std::jthread producer { [&logger]() {
+      for (int i = 1; i < 6; ++i) {
+        logger.write(level::info, std::to_string(i));
+      }
+    } };
+
+    if (overflow_policy != policy::Block) {
+      // The producer will not block, so we can wait for it
+      producer.join();
+    }
+
+    callback_released = true;
+    callback_released.notify_all();
+    if (producer.joinable()) {
+      producer.join();
+    }
+    logger.disableAsync();
+
+    return output;
+  } };
+
+  logger.setLogLevel(level::verbose);
+  EXPECT_EQ(write_with_full_queue(policy::Drop), (std::vector<std::string> { "0", "1", "2" }));
+  EXPECT_EQ(write_with_full_queue(policy::CountAndDrop), (std::vector<std::string> { "0", "1", "2", "3 log record(s) were dropped due to the full asynchronous log queue!" }));
+  EXPECT_EQ(write_with_full_queue(policy::Block), (std::vector<std::string> { "0", "1", "2", "3", "4", "5" }));
+}
+
+TEST_S(CompileTimeLogLevel) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  int invocations { 0 };
+  const auto some_function { [&invocations]() {
+    invocations++;
+    return "some string";
+  } };
+
+  logger.setCustomCallback([](auto, auto) {});
+  logger.setLogLevel(level::verbose);
+
+  int expected_invocations { 0 };
+  for (const auto log_level : { level::verbose, level::debug, level::info, level::warning, level::error, level::fatal }) {
+    EXPECT_EQ(display_device::Logger::isLogLevelCompiledIn(log_level), static_cast<int>(log_level) >= DD_LOG_MIN_LEVEL);
+    if (display_device::Logger::isLogLevelCompiledIn(log_level)) {
+      expected_invocations++;
+    }
+  }
+
+  DD_LOG(verbose) << some_function();
+  DD_LOG(debug) << some_function();
+  DD_LOG(info) << some_function();
+  DD_LOG(warning) << some_function();
+  DD_LOG(error) << some_function();
+  DD_LOG(fatal) << some_function();
+  EXPECT_EQ(invocations, expected_invocations);
+}
+
+TEST_S(Channels, IndependentLogLevels) {
+  using channel = display_device::Logger::LogChannel;
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  logger.setLogLevel(level::error);
+  logger.setLogLevel(channel::winapi, level::verbose);
+
+  EXPECT_TRUE(logger.isLogLevelEnabled(channel::winapi, level::verbose));
+  EXPECT_FALSE(logger.isLogLevelEnabled(channel::general, level::warning));
+  EXPECT_FALSE(logger.isLogLevelEnabled(level::warning));
+  EXPECT_FALSE(logger.isLogLevelEnabled(channel::scheduler, level::warning));
+  EXPECT_TRUE(logger.isLogLevelEnabled(channel::scheduler, level::error));
+
+  // Setting the level without a channel overrides all of them
+  logger.setLogLevel(level::fatal);
+  EXPECT_FALSE(logger.isLogLevelEnabled(channel::winapi, level::error));
+  EXPECT_FALSE(logger.isLogLevelEnabled(channel::general, level::error));
+}
+
+TEST_S(Channels, LogMacro) {
+  using channel = display_device::Logger::LogChannel;
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  int invocations { 0 };
+  const auto some_function { [&invocations]() {
+    invocations++;
+    return "some string";
+  } };
+
+  std::vector<channel> output;
+  logger.setCustomRecordCallback([&output](const display_device::LogRecord &record) {
+    output.push_back(record.getChannel());
+  });
+  logger.setLogLevel(level::fatal);
+  logger.setLogLevel(channel::settings, level::error);
+
+  DD_LOG_CH(settings, error) << some_function();
+  DD_LOG_CH(winapi, error) << some_function();
+  DD_LOG(error) << some_function();
+  EXPECT_EQ(invocations, 1);
+  EXPECT_EQ(output, std::vector<channel> { channel::settings });
+
+  output.clear();
+  logger.write(display_device::LogRecord { level::error, channel::winapi });
+  logger.write(display_device::LogRecord { level::error, channel::settings });
+  EXPECT_EQ(output, std::vector<channel> { channel::settings });
+}
+
+TEST_S(Deduplication) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](auto, std::string_view value) {
+    output.emplace_back(value);
+  });
+
+  const auto hash_marker { [](std::string_view payload) {
+    std::ostringstream stream;
+    stream << "unchanged (hash=" << std::hex << display_device::detail::hashLogPayload(payload) << ")";
+    return stream.str();
+  } };
+
+  for (const auto *payload : { "Payload A", "Payload A", "Payload B", "Payload B", "Payload A" }) {
+    DD_LOG(error) << "Value: " << DD_LOG_DEDUP(std::string { payload });
+  }
+  const auto other_call_site { [](std::string_view payload) {
+    DD_LOG(error) << "Value: " << DD_LOG_DEDUP(payload);
+  } };
+  other_call_site("Payload A");
+
+  EXPECT_EQ(output, (std::vector<std::string> {
+                      "Value: Payload A",
+                      "Value: " + hash_marker("Payload A"),
+                      "Value: Payload B",
+                      "Value: " + hash_marker("Payload B"),
+                      "Value: Payload A",
+                      "Value: Payload A",
+                    }));
+}
+
+TEST_S(Deduplication, FlightRecorder) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string_view value) {
+    output.emplace_back(value);
+  });
+  logger.setLogLevel(level::error);
+  logger.enableFlightRecorder({ .m_capture_level = level::debug, .m_dump_on_error = false });
+
+  const auto hash_marker { [](std::string_view payload) {
+    std::ostringstream stream;
+    stream << std::hex << display_device::detail::hashLogPayload(payload);
+    return stream.str();
+  } };
+  const auto log_payload { [](const level log_level, std::string_view payload) {
+    // Same call site for both levels
+    display_device::LogWriter { log_level } << DD_LOG_DEDUP(payload);
+  } };
+
+  // Records captured only by the flight recorder keep the full payload and do not update the call site state
+  for (const auto *payload : { "Payload A", "Payload A" }) {
+    DD_LOG(debug) << "Value: " << DD_LOG_DEDUP(std::string { payload });
+  }
+  log_payload(level::error, "Payload B");
+  log_payload(level::debug, "Payload C");
+  log_payload(level::error, "Payload B");
+  EXPECT_EQ(output, (std::vector<std::string> {
+                      "Payload B",
+                      "unchanged (hash=" + hash_marker("Payload B") + ")",
+                    }));
+
+  output.clear();
+  logger.dumpFlightRecorder();
+  EXPECT_EQ(output, (std::vector<std::string> {
+                      "Flight recorder dump of 3 record(s) that were not written out:",
+                      "Value: Payload A",
+                      "Value: Payload A",
+                      "Payload C",
+                      "End of the flight recorder dump.",
+                    }));
+  logger.disableFlightRecorder();
+}
+
+TEST_S(FlightRecorder, DumpOnDemand) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](const level log_level, std::string_view value) {
+    output.push_back(std::to_string(static_cast<int>(log_level)) + " " + std::string { value });
+  });
+  logger.setLogLevel(level::error);
+  logger.enableFlightRecorder({ .m_capacity = 4, .m_capture_level = level::debug, .m_dump_on_error = false });
+
+  EXPECT_TRUE(logger.isFlightRecorderEnabled());
+  EXPECT_TRUE(display_device::Logger::isLogLevelCaptured(display_device::Logger::LogChannel::general, level::debug));
+  EXPECT_FALSE(display_device::Logger::isLogLevelCaptured(display_device::Logger::LogChannel::general, level::verbose));
+  EXPECT_FALSE(logger.isLogLevelEnabled(level::debug));
+
+  logger.write(level::verbose, "Not captured");
+  for (int i = 0; i < 6; ++i) {
+    logger.write(level::debug, "Debug " + std::to_string(i));
+  }
+  logger.write(level::info, "Info");
+  EXPECT_TRUE(output.empty());
+
+  logger.dumpFlightRecorder();
+  EXPECT_EQ(output, (std::vector<std::string> {
+                      "2 Flight recorder dump of 4 record(s) that were not written out:",
+                      "1 Debug 3",
+                      "1 Debug 4",
+                      "1 Debug 5",
+                      "2 Info",
+                      "2 End of the flight recorder dump.",
+                    }));
+
+  // Already dumped records are not dumped again
+  output.clear();
+  logger.dumpFlightRecorder();
+  EXPECT_TRUE(output.empty());
+
+  logger.disableFlightRecorder();
+  EXPECT_FALSE(logger.isFlightRecorderEnabled());
+  EXPECT_FALSE(display_device::Logger::isLogLevelCaptured(display_device::Logger::LogChannel::general, level::debug));
+}
+
+TEST_S(FlightRecorder, DumpOnError) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string_view value) {
+    output.emplace_back(value);
+  });
+  logger.setLogLevel(level::warning);
+  logger.enableFlightRecorder({ .m_record_size = 48 });
+
+  DD_LOG(verbose) << "Some verbose context " << 123;
+  DD_LOG(warning) << "Warning";
+  DD_LOG(info) << "Long context " << std::string(64, 'x');
+  DD_LOG(error) << "Error";
+
+  EXPECT_EQ(output, (std::vector<std::string> {
+                      "Warning",
+                      "Flight recorder dump of 2 record(s) that were not written out:",
+                      "Some verbose context 123",
+                      "Long context " + std::string(25, 'x') + " [truncated]",
+                      "End of the flight recorder dump.",
+                      "Error",
+                    }));
+}
+
+TEST_S(CustomRecordCallback) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger { display_device::Logger::get() };
+
+  std::vector<std::string> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomRecordCallback([&output](const display_device::LogRecord &record) {
+    EXPECT_EQ(record.getLogLevel(), level::warning);
+    EXPECT_NE(record.getTimestamp(), std::chrono::system_clock::time_point {});
+    record.visit([&output](const auto &value) {
+      using T = std::decay_t<decltype(value)>;
+      if constexpr (std::is_same_v<T, std::string_view>) {
+        output.push_back("string_view: " + std::string { value });
+      }
+      else if constexpr (std::is_same_v<T, std::int64_t>) {
+        output.push_back("int64: " + std::to_string(value));
+      }
+      else if constexpr (std::is_same_v<T, std::uint64_t>) {
+        output.push_back("uint64: " + std::to_string(value));
+      }
+      else if constexpr (std::is_same_v<T, bool>) {
+        output.push_back(std::string { "bool: " } + (value ? "true" : "false"));
+      }
+      else {
+        output.push_back("other");
+      }
+    });
+  });
+
+  DD_LOG(warning) << "Hello World! " << -1 << 2u << true << level::error << std::string { "JSON" } << 1.5;
+  EXPECT_EQ(output, (std::vector<std::string> { "string_view: Hello World! ", "int64: -1", "uint64: 2", "bool: true", "int64: 4", "string_view: JSON", "other" }));
+
+  // The callbacks are mutually exclusive
+  std::string text_output;
+  logger.setCustomCallback([&text_output](auto, std::string_view value) {
+    text_output = value;
+  });
+
+  output.clear();
+  DD_LOG(warning) << "Hello World!";
+  EXPECT_TRUE(output.empty());
+  EXPECT_EQ(text_output, "Hello World!");
+}
+
+TEST_S(LogRecord, FormatSameAsStream) {
+  const auto format_both { [](auto &&...values) {
+    display_device::LogRecord record;
+    std::ostringstream stream;
+    (record.append(values), ...);
+    (stream << ... << values);
+    return std::make_pair(record.toString(), stream.str());
+  } };
+
+  const auto compare { [](const auto &pair) {
+    EXPECT_EQ(pair.first, pair.second);
+  } };
+
+  const std::string string_value { "string" };
+  const char *null_string { nullptr };
+  const int value { 123 };
+  compare(format_both("Hello World!", ' ', string_value, std::string_view { "view" }));
+  compare(format_both(-5, 5u, static_cast<short>(-7), 1234567890123LL, static_cast<std::uint8_t>('a')));
+  compare(format_both(1.5, 0.1f, 1e20, 1.0 / 3.0, 100.0));
+  compare(format_both(true, false, std::boolalpha, true, false, std::noboolalpha, true));
+  compare(format_both(std::hex, 255, ' ', -1LL, std::uppercase, ' ', 255, std::showbase, ' ', 255, std::oct, ' ', 8, std::dec, ' ', 8));
+  compare(format_both(std::hex, int { -1 }, ' ', static_cast<short>(-1), ' ', -1L, ' ', std::int8_t { -1 }, std::oct, ' ', int { -8 }, ' ', static_cast<short>(-8)));
+  compare(format_both(std::fixed, 1.5, ' ', std::scientific, 1.5, ' ', std::defaultfloat, 1.5));
+  compare(format_both(&value, ' ', static_cast<const void *>(nullptr)));
+  compare(format_both(std::filesystem::path { "some/path" }));
+  compare(format_both(StreamedNumber { 255 }, ' ', std::hex, std::boolalpha, std::showbase, StreamedNumber { 255 }, std::dec, std::noboolalpha, ' ', StreamedNumber { 255 }));
+  compare(format_both(reinterpret_cast<const unsigned char *>("unsigned"), ' ', reinterpret_cast<const signed char *>("signed")));
+  compare(format_both(std::showpos, 5, ' ', -5, ' ', 0, ' ', 5u, ' ', 1.5, ' ', 0.0, ' ', -0.0, ' ', true, std::hex, ' ', 5, std::dec, std::noshowpos, ' ', 5));
+  compare(format_both(std::uppercase, std::scientific, 1.5e20, ' ', std::numeric_limits<double>::infinity(), ' ', std::hex, std::showbase, 255, ' ', -1, ' ', &value));
+  compare(format_both(std::hexfloat, 1.5, ' ', -0.1, ' ', 0.0, ' ', 1e300, ' ', std::numeric_limits<double>::infinity(), ' ', std::showpos, 2.0, ' ', std::uppercase, 0.1));
+  EXPECT_EQ(format_both(null_string).first, "");
+  EXPECT_EQ(format_both(std::hex, int { -1 }).first, "ffffffff");
+}
+
+TEST_S(CachedTimestamp) {
+  const auto format_with_put_time { [](const std::chrono::system_clock::time_point timestamp) {
+    const auto now_ms { std::chrono::duration_cast<std::chrono::milliseconds>(timestamp.time_since_epoch()) };
+    const std::time_t time { std::chrono::system_clock::to_time_t(timestamp) };
+    const auto localtime { *std::localtime(&time) };
+
+    std::ostringstream stream;
+    stream << std::put_time(&localtime, "[%Y-%m-%d %H:%M:%S.") << std::setfill('0') << std::setw(3) << (now_ms.count() % 1000) << "] ";
+    return stream.str();
+  } };
+
+  const auto format_with_cache { [](const std::chrono::system_clock::time_point timestamp) {
+    std::string output;
+    display_device::detail::appendLogTimestamp(output, timestamp);
+    return output;
+  } };
+
+  const auto start { std::chrono::time_point_cast<std::chrono::seconds>(std::chrono::system_clock::now()) };
+  for (const auto offset : { 0ms, 1ms, 10ms, 999ms, 1000ms, 1001ms, 1500ms, 60000ms, 59999ms, 3600000ms }) {
+    const auto timestamp { start + offset };
+    EXPECT_EQ(format_with_cache(timestamp), format_with_put_time(timestamp));
+  }
+}
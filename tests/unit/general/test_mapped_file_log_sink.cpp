@@ -0,0 +1,179 @@
+// system includes
+#include <fstream>
+#include <gmock/gmock.h>
+#include <thread>
+
+// local includes
+#include "display_device/mapped_file_log_sink.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class MappedFileLogSinkTest: public BaseTest {
+  public:
+    MappedFileLogSinkTest() {
+      std::filesystem::remove_all(m_directory);
+      std::filesystem::create_directory(m_directory);
+    }
+
+    ~MappedFileLogSinkTest() override {
+      std::filesystem::remove_all(m_directory);
+    }
+
+    [[nodiscard]] std::string
+    readFile(const std::filesystem::path &filepath) const {
+      std::ifstream stream { filepath, std::ios::binary };
+      return { std::istreambuf_iterator<char> { stream }, std::istreambuf_iterator<char> {} };
+    }
+
+    [[nodiscard]] std::vector<std::string>
+    getFilenames() const {
+      std::vector<std::string> filenames;
+      for (const auto &entry : std::filesystem::directory_iterator { m_directory }) {
+        filenames.push_back(entry.path().filename().string());
+      }
+      std::ranges::sort(filenames);
+      return filenames;
+    }
+
+    std::filesystem::path m_directory { "mapped_file_log_sink_test" };
+    std::filesystem::path m_filepath { m_directory / "test.log" };
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, MappedFileLogSinkTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(InvalidOptionsProvided) {
+  EXPECT_THAT([]() { const display_device::MappedFileLogSink sink { {} }; },
+    ThrowsMessage<std::runtime_error>(HasSubstr("Empty filename provided for MappedFileLogSink!")));
+
+  display_device::MappedFileLogSink::Options options { m_filepath };
+  options.m_segment_size = 0;
+  EXPECT_THAT([&options]() { const display_device::MappedFileLogSink sink { options }; },
+    ThrowsMessage<std::runtime_error>(HasSubstr("Segment size and count must be larger than 0 for MappedFileLogSink!")));
+
+  options.m_segment_size = 1024;
+  options.m_max_segments = 0;
+  EXPECT_THAT([&options]() { const display_device::MappedFileLogSink sink { options }; },
+    ThrowsMessage<std::runtime_error>(HasSubstr("Segment size and count must be larger than 0 for MappedFileLogSink!")));
+}
+
+TEST_F_S(Write, TruncatedOnClose) {
+  {
+    display_device::MappedFileLogSink sink { { .m_filepath = m_filepath, .m_segment_size = 1024 } };
+    EXPECT_EQ(sink.getCurrentSegmentPath(), m_directory / "test.0.log");
+
+    sink.write("Hello ");
+    sink.write("World!\n");
+
+    // The file is preallocated while the sink is alive
+    EXPECT_EQ(std::filesystem::file_size(sink.getCurrentSegmentPath()), 1024);
+  }
+
+  EXPECT_EQ(readFile(m_directory / "test.0.log"), "Hello World!\n");
+}
+
+TEST_F_S(Write, Record) {
+  {
+    display_device::MappedFileLogSink sink { { .m_filepath = m_filepath, .m_segment_size = 1024 } };
+    display_device::LogRecord record { display_device::Logger::LogLevel::warning };
+    record.append("Some value: ");
+    record.append(123);
+    sink.write(record);
+  }
+
+  EXPECT_THAT(readFile(m_directory / "test.0.log"), HasSubstr("] WARNING: Some value: 123\n"));
+}
+
+TEST_F_S(Write, Rotation) {
+  {
+    display_device::MappedFileLogSink sink { { .m_filepath = m_filepath, .m_segment_size = 8, .m_max_segments = 2 } };
+    sink.write("1111");
+    sink.write("2222");
+    sink.write("3333");
+    sink.write("4444");
+    sink.write("5555");
+    sink.write("123456789");
+    EXPECT_EQ(sink.getCurrentSegmentPath(), m_directory / "test.3.log");
+    EXPECT_EQ(sink.getDroppedCount(), 0);
+  }
+
+  EXPECT_EQ(getFilenames(), (std::vector<std::string> { "test.2.log", "test.3.log" }));
+  EXPECT_EQ(readFile(m_directory / "test.2.log"), "5555");
+  EXPECT_EQ(readFile(m_directory / "test.3.log"), "12345678");
+}
+
+TEST_F_S(Write, NextSegmentPreCreated) {
+  using namespace std::chrono_literals;
+  {
+    display_device::MappedFileLogSink sink { { .m_filepath = m_filepath, .m_segment_size = 8 } };
+
+    // The next segment is created in the background, so that the writer only needs to swap it in
+    const auto wait_for_file_size { [](const std::filesystem::path &filepath, const std::uintmax_t size) {
+      for (int i = 0; i < 5000; ++i) {
+        std::error_code error_code;
+        if (std::filesystem::file_size(filepath, error_code) == size && !error_code) {
+          return true;
+        }
+        std::this_thread::sleep_for(1ms);
+      }
+      return false;
+    } };
+    EXPECT_TRUE(wait_for_file_size(m_directory / "test.1.log", 8));
+
+    sink.write("1111");
+    sink.write("22222");
+    EXPECT_EQ(sink.getCurrentSegmentPath(), m_directory / "test.1.log");
+
+    // The full segment is closed in the background as well
+    EXPECT_TRUE(wait_for_file_size(m_directory / "test.0.log", 4));
+    EXPECT_TRUE(wait_for_file_size(m_directory / "test.2.log", 8));
+  }
+
+  // The unused pre-created segment is removed
+  EXPECT_EQ(getFilenames(), (std::vector<std::string> { "test.0.log", "test.1.log" }));
+  EXPECT_EQ(readFile(m_directory / "test.1.log"), "22222");
+}
+
+TEST_F_S(Write, ContinuesPreviousNumbering) {
+  for (int i = 0; i < 3; ++i) {
+    display_device::MappedFileLogSink sink { { .m_filepath = m_filepath, .m_segment_size = 64, .m_max_segments = 2 } };
+    sink.write("Run " + std::to_string(i));
+  }
+
+  EXPECT_EQ(getFilenames(), (std::vector<std::string> { "test.1.log", "test.2.log" }));
+  EXPECT_EQ(readFile(m_directory / "test.1.log"), "Run 1");
+  EXPECT_EQ(readFile(m_directory / "test.2.log"), "Run 2");
+}
+
+TEST_F_S(Write, MultipleThreads) {
+  constexpr int thread_count { 4 };
+  constexpr int lines_per_thread { 1000 };
+  {
+    display_device::MappedFileLogSink sink { { .m_filepath = m_filepath, .m_segment_size = 4096, .m_max_segments = 1000 } };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+      threads.emplace_back([&sink, i]() {
+        const std::string line { "Thread " + std::to_string(i) + "\n" };
+        for (int j = 0; j < lines_per_thread; ++j) {
+          sink.write(line);
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  std::string data;
+  for (const auto &filename : getFilenames()) {
+    data += readFile(m_directory / filename);
+  }
+  EXPECT_EQ(std::ranges::count(data, '\n'), thread_count * lines_per_thread);
+  EXPECT_EQ(data.size(), thread_count * lines_per_thread * std::string { "Thread 0\n" }.size());
+}
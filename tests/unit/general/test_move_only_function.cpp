@@ -0,0 +1,97 @@
+// system includes
+#include <array>
+#include <gmock/gmock.h>
+#include <memory>
+#include <vector>
+
+// local includes
+#include "display_device/move_only_function.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, MoveOnlyFunction, __VA_ARGS__)
+
+  int
+  addOne(const int value) {
+    return value + 1;
+  }
+}  // namespace
+
+TEST_S(Empty) {
+  display_device::MoveOnlyFunction<void()> default_function;
+  display_device::MoveOnlyFunction<void()> nullptr_function { nullptr };
+  display_device::MoveOnlyFunction<int(int)> nullptr_pointer { static_cast<int (*)(int)>(nullptr) };
+  display_device::MoveOnlyFunction<int(int)> empty_std_function { std::function<int(int)> {} };
+
+  EXPECT_FALSE(default_function);
+  EXPECT_FALSE(nullptr_function);
+  EXPECT_FALSE(nullptr_pointer);
+  EXPECT_FALSE(empty_std_function);
+  EXPECT_TRUE(default_function.isInline());
+  EXPECT_THROW(default_function(), std::bad_function_call);
+}
+
+TEST_S(Inline) {
+  int counter { 0 };
+  display_device::MoveOnlyFunction<void(int)> function { [&counter](const int value) { counter += value; } };
+  ASSERT_TRUE(function);
+  EXPECT_TRUE(function.isInline());
+
+  function(2);
+  function(3);
+  EXPECT_EQ(counter, 5);
+}
+
+TEST_S(FunctionPointer) {
+  display_device::MoveOnlyFunction<int(int)> function { &addOne };
+  EXPECT_TRUE(function.isInline());
+  EXPECT_EQ(function(1), 2);
+}
+
+TEST_S(Heap) {
+  std::array<int, 64> values {};
+  values.back() = 42;
+
+  display_device::MoveOnlyFunction<int()> function { [values]() { return values.back(); } };
+  EXPECT_FALSE(function.isInline());
+  EXPECT_EQ(function(), 42);
+
+  auto moved_function { std::move(function) };
+  EXPECT_FALSE(function);
+  EXPECT_EQ(moved_function(), 42);
+}
+
+TEST_S(MoveOnlyCapture) {
+  display_device::MoveOnlyFunction<int()> function { [value = std::make_unique<int>(5)]() { return *value; } };
+  EXPECT_TRUE(function.isInline());
+
+  display_device::MoveOnlyFunction<int()> other;
+  other = std::move(function);
+  EXPECT_FALSE(function);
+  EXPECT_EQ(other(), 5);
+}
+
+TEST_S(ReferenceArguments) {
+  display_device::MoveOnlyFunction<int &(std::vector<int> &)> function { [](std::vector<int> &values) -> int & { return values.front(); } };
+
+  std::vector<int> values { 1, 2 };
+  function(values) = 7;
+  EXPECT_EQ(values.front(), 7);
+}
+
+TEST_S(DestroysCallable) {
+  const auto inline_value { std::make_shared<int>(0) };
+  const auto heap_value { std::make_shared<int>(0) };
+  {
+    display_device::MoveOnlyFunction<void()> inline_function { [inline_value]() {} };
+    display_device::MoveOnlyFunction<void()> heap_function { [heap_value, padding = std::array<char, 128> {}]() {} };
+    EXPECT_EQ(inline_value.use_count(), 2);
+    EXPECT_EQ(heap_value.use_count(), 2);
+
+    inline_function = std::move(heap_function);
+    EXPECT_EQ(inline_value.use_count(), 1);
+    EXPECT_EQ(heap_value.use_count(), 2);
+  }
+  EXPECT_EQ(heap_value.use_count(), 1);
+}
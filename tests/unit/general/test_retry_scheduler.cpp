@@ -1,5 +1,10 @@
 // system includes
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <future>
 #include <gmock/gmock.h>
+#include <shared_mutex>
 
 // local includes
 #include "display_device/retry_scheduler.h"
@@ -28,6 +33,30 @@ namespace {
     return static_cast<int>(std::round(value * 0.99));
   }
 
+  // Waits until the scheduler thread is waiting for the deadline so that the time can be advanced
+  void
+  waitForWaiter(const display_device::ManualSchedulerClock &clock) {
+    while (clock.getWaiterCount() == 0) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  // A minimal coroutine type that starts eagerly and is never awaited
+  struct DetachedTask {
+    struct promise_type {
+      DetachedTask
+      get_return_object() { return {}; }
+      std::suspend_never
+      initial_suspend() noexcept { return {}; }
+      std::suspend_never
+      final_suspend() noexcept { return {}; }
+      void
+      return_void() { /* noop */ }
+      void
+      unhandled_exception() { std::terminate(); }
+    };
+  };
+
   // Test fixture(s) for this file
   class RetrySchedulerTest: public BaseTest {
   public:
@@ -43,11 +72,28 @@ TEST_F_S(NullptrInterfaceProvided) {
     ThrowsMessage<std::logic_error>(HasSubstr("Nullptr interface provided in RetryScheduler!")));
 }
 
+TEST_F_S(NullptrClockProvided) {
+  EXPECT_THAT([]() { const display_device::RetryScheduler<TestIface> scheduler(std::make_unique<TestIface>(), std::shared_ptr<display_device::SchedulerClock> {}); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Nullptr clock provided in RetryScheduler!")));
+}
+
 TEST_F_S(Schedule, NullptrCallbackProvided) {
   EXPECT_THAT([&]() { m_impl.schedule(nullptr, { .m_sleep_durations = { 0ms } }); },
     ThrowsMessage<std::logic_error>(HasSubstr("Empty callback function provided in RetryScheduler::schedule!")));
 }
 
+TEST_F_S(Schedule, MoveOnlyCallback) {
+  int counter { 0 };
+  m_impl.schedule([&counter, value = std::make_unique<int>(3)](auto, auto &stop_token) {
+    counter += *value;
+    stop_token.requestStop();
+  },
+    { .m_sleep_durations = { 1ms } });
+
+  EXPECT_EQ(counter, 3);
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
 TEST_F_S(Schedule, NoDurations) {
   EXPECT_THAT([&]() { m_impl.schedule([](auto, auto &) {}, { .m_sleep_durations = {} }); },
     ThrowsMessage<std::logic_error>(HasSubstr("At least 1 sleep duration must be specified in RetryScheduler::schedule!")));
@@ -136,21 +182,25 @@ TEST_F_S(Schedule, StoppedImmediately) {
 
 TEST_F_S(Schedule, Execution, Immediate) {
   const auto default_duration { 500ms };
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
   const auto calling_thread_id { std::this_thread::get_id() };
   std::optional<std::thread::id> first_call_scheduler_thread_id;
   std::optional<std::thread::id> second_call_scheduler_thread_id;
-
-  int first_call_delay { -1 };
-  int second_call_delay { -1 };
-  auto prev = std::chrono::high_resolution_clock::now();
-  m_impl.schedule([&](auto, auto &stop_token) {
-    const auto now = std::chrono::high_resolution_clock::now();
-    const auto duration = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(now - prev).count());
+  std::atomic<bool> first_call_done { false };
+
+  std::optional<std::chrono::nanoseconds> first_call_delay;
+  std::optional<std::chrono::nanoseconds> second_call_delay;
+  auto prev = clock->now();
+  scheduler.schedule([&](auto, auto &stop_token) {
+    const auto now = clock->now();
+    const auto duration = now - prev;
     prev = now;
 
     if (!first_call_scheduler_thread_id) {
       first_call_delay = duration;
       first_call_scheduler_thread_id = std::this_thread::get_id();
+      first_call_done = true;
       return;
     }
 
@@ -160,14 +210,16 @@ TEST_F_S(Schedule, Execution, Immediate) {
   },
     { .m_sleep_durations = { default_duration * 2, default_duration }, .m_execution = display_device::SchedulerOptions::Execution::Immediate });
 
-  while (m_impl.isScheduled()) {
+  EXPECT_TRUE(first_call_done);
+  waitForWaiter(*clock);
+  clock->advance(default_duration * 2);
+
+  while (scheduler.isScheduled()) {
     std::this_thread::sleep_for(1ms);
   }
 
-  EXPECT_GE(first_call_delay, roundTo99(0));
-  EXPECT_LT(first_call_delay, default_duration.count());
-  EXPECT_GE(second_call_delay, roundTo99(default_duration.count() * 2));
-  EXPECT_LT(second_call_delay, default_duration.count() * 3);
+  EXPECT_EQ(first_call_delay, 0ms);
+  EXPECT_EQ(second_call_delay, default_duration * 2);
 
   EXPECT_TRUE(first_call_scheduler_thread_id);
   EXPECT_TRUE(second_call_scheduler_thread_id);
@@ -178,21 +230,25 @@ TEST_F_S(Schedule, Execution, Immediate) {
 
 TEST_F_S(Schedule, Execution, ImmediateWithSleep) {
   const auto default_duration { 500ms };
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
   const auto calling_thread_id { std::this_thread::get_id() };
   std::optional<std::thread::id> first_call_scheduler_thread_id;
   std::optional<std::thread::id> second_call_scheduler_thread_id;
-
-  int first_call_delay { -1 };
-  int second_call_delay { -1 };
-  auto prev = std::chrono::high_resolution_clock::now();
-  m_impl.schedule([&](auto, auto &stop_token) {
-    const auto now = std::chrono::high_resolution_clock::now();
-    const auto duration = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(now - prev).count());
+  std::atomic<bool> first_call_done { false };
+
+  std::optional<std::chrono::nanoseconds> first_call_delay;
+  std::optional<std::chrono::nanoseconds> second_call_delay;
+  auto prev = clock->now();
+  scheduler.schedule([&](auto, auto &stop_token) {
+    const auto now = clock->now();
+    const auto duration = now - prev;
     prev = now;
 
     if (!first_call_scheduler_thread_id) {
       first_call_delay = duration;
       first_call_scheduler_thread_id = std::this_thread::get_id();
+      first_call_done = true;
       return;
     }
 
@@ -202,14 +258,16 @@ TEST_F_S(Schedule, Execution, ImmediateWithSleep) {
   },
     { .m_sleep_durations = { default_duration * 2, default_duration }, .m_execution = display_device::SchedulerOptions::Execution::ImmediateWithSleep });
 
-  while (m_impl.isScheduled()) {
+  EXPECT_TRUE(first_call_done);
+  waitForWaiter(*clock);
+  clock->advance(default_duration);
+
+  while (scheduler.isScheduled()) {
     std::this_thread::sleep_for(1ms);
   }
 
-  EXPECT_GE(first_call_delay, roundTo99(default_duration.count() * 2));
-  EXPECT_LT(first_call_delay, default_duration.count() * 3);
-  EXPECT_GE(second_call_delay, roundTo99(default_duration.count()));
-  EXPECT_LT(second_call_delay, default_duration.count() * 2);
+  EXPECT_EQ(first_call_delay, default_duration * 2);
+  EXPECT_EQ(second_call_delay, default_duration);
 
   EXPECT_TRUE(first_call_scheduler_thread_id);
   EXPECT_TRUE(second_call_scheduler_thread_id);
@@ -220,21 +278,25 @@ TEST_F_S(Schedule, Execution, ImmediateWithSleep) {
 
 TEST_F_S(Schedule, Execution, ScheduledOnly) {
   const auto default_duration { 500ms };
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
   const auto calling_thread_id { std::this_thread::get_id() };
   std::optional<std::thread::id> first_call_scheduler_thread_id;
   std::optional<std::thread::id> second_call_scheduler_thread_id;
-
-  int first_call_delay { -1 };
-  int second_call_delay { -1 };
-  auto prev = std::chrono::high_resolution_clock::now();
-  m_impl.schedule([&](auto, auto &stop_token) {
-    const auto now = std::chrono::high_resolution_clock::now();
-    const auto duration = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(now - prev).count());
+  std::atomic<bool> first_call_done { false };
+
+  std::optional<std::chrono::nanoseconds> first_call_delay;
+  std::optional<std::chrono::nanoseconds> second_call_delay;
+  auto prev = clock->now();
+  scheduler.schedule([&](auto, auto &stop_token) {
+    const auto now = clock->now();
+    const auto duration = now - prev;
     prev = now;
 
     if (!first_call_scheduler_thread_id) {
       first_call_delay = duration;
       first_call_scheduler_thread_id = std::this_thread::get_id();
+      first_call_done = true;
       return;
     }
 
@@ -244,14 +306,19 @@ TEST_F_S(Schedule, Execution, ScheduledOnly) {
   },
     { .m_sleep_durations = { default_duration * 2, default_duration }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
 
-  while (m_impl.isScheduled()) {
+  clock->advance(default_duration * 2);
+  while (!first_call_done) {
     std::this_thread::sleep_for(1ms);
   }
+  waitForWaiter(*clock);
+  clock->advance(default_duration);
 
-  EXPECT_GE(first_call_delay, roundTo99(default_duration.count() * 2));
-  EXPECT_LT(first_call_delay, default_duration.count() * 3);
-  EXPECT_GE(second_call_delay, roundTo99(default_duration.count()));
-  EXPECT_LT(second_call_delay, default_duration.count() * 2);
+  while (scheduler.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(first_call_delay, default_duration * 2);
+  EXPECT_EQ(second_call_delay, default_duration);
 
   EXPECT_TRUE(first_call_scheduler_thread_id);
   EXPECT_TRUE(second_call_scheduler_thread_id);
@@ -270,7 +337,7 @@ TEST_F_S(Schedule, ExceptionThrown, DuringImmediateCall) {
   }
 
   std::string output;
-  logger.setCustomCallback([&output](auto, const std::string &value) {
+  logger.setCustomCallback([&output](auto, std::string_view value) {
     output = value;
   });
 
@@ -297,7 +364,7 @@ TEST_F_S(Schedule, ExceptionThrown, DuringScheduledCall) {
   auto &logger { display_device::Logger::get() };
 
   std::string output;
-  logger.setCustomCallback([&output](auto, const std::string &value) {
+  logger.setCustomCallback([&output](auto, std::string_view value) {
     output = value;
   });
 
@@ -507,6 +574,326 @@ TEST_F_S(Execute, ConstVsNonConst, WithStopToken) {
   // const_impl.execute(non_const_non_const_callback_auto);
 }
 
+TEST_F_S(ExecuteBatch, NullptrCallbackProvided) {
+  int counter { 0 };
+  EXPECT_THAT([&]() { static_cast<void>(m_impl.executeBatch([&](auto) { counter++; }, std::function<void(TestIface &)> {})); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Empty callback function provided in RetryScheduler::executeBatch!")));
+  EXPECT_EQ(counter, 0);
+}
+
+TEST_F_S(ExecuteBatch, Results) {
+  std::vector<int> order;
+  const auto [number, nothing, text] = m_impl.executeBatch(
+    [&](TestIface &iface) {
+      order.push_back(1);
+      iface.m_durations.push_back(5);
+      return 42;
+    },
+    [&](auto, auto &) { order.push_back(2); },
+    [&](const TestIface &iface) {
+      order.push_back(3);
+      return std::to_string(iface.m_durations.back());
+    });
+
+  EXPECT_EQ(number, 42);
+  EXPECT_EQ(nothing, std::monostate {});
+  EXPECT_EQ(text, "5");
+  EXPECT_EQ(order, std::vector<int>({ 1, 2, 3 }));
+  EXPECT_EQ(m_impl.getMetrics().m_lock_wait.m_count, 1);
+}
+
+TEST_F_S(ExecuteBatch, Const) {
+  const auto &const_impl { m_impl };
+  const auto result { const_impl.executeBatch([](const TestIface &iface) { return iface.m_durations.size(); }) };
+  EXPECT_EQ(std::get<0>(result), 0);
+}
+
+TEST_F_S(ExecuteBatch, StopToken) {
+  m_impl.schedule([](auto, auto &) {}, { .m_sleep_durations = { 1h } });
+  EXPECT_TRUE(m_impl.isScheduled());
+
+  const auto result { m_impl.executeBatch([](auto, auto &stop_token) {
+    stop_token.requestStop();
+    return true;
+  }) };
+  EXPECT_TRUE(std::get<0>(result));
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(ExecuteBatch, ExceptionStopsBatch) {
+  int counter { 0 };
+  EXPECT_THROW(static_cast<void>(m_impl.executeBatch([&](auto) { counter++; }, [](auto) { throw std::runtime_error { "failed" }; }, [&](auto) { counter++; })), std::runtime_error);
+  EXPECT_EQ(counter, 1);
+  EXPECT_EQ(m_impl.execute([&](auto) { return counter; }), 1);
+}
+
+TEST_F_S(ExecuteAsync, NullptrCallbackProvided) {
+  EXPECT_THAT([&]() { static_cast<void>(m_impl.executeAsync(std::function<void(TestIface &)> {})); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Empty callback function provided in RetryScheduler::executeAsync!")));
+}
+
+TEST_F_S(ExecuteAsync, ExecutedOnSchedulerThread) {
+  const auto calling_thread_id { std::this_thread::get_id() };
+  auto future { m_impl.executeAsync([](TestIface &iface) {
+    iface.m_durations.push_back(1);
+    return std::this_thread::get_id();
+  }) };
+
+  EXPECT_NE(future.get(), calling_thread_id);
+  EXPECT_EQ(m_impl.execute([](TestIface &iface) { return iface.m_durations; }), std::vector<int> { 1 });
+}
+
+TEST_F_S(ExecuteAsync, WithStopToken) {
+  m_impl.schedule([](auto, auto &) {}, { .m_sleep_durations = { 1ms } });
+  EXPECT_TRUE(m_impl.isScheduled());
+
+  m_impl.executeAsync([](TestIface &, auto &stop_token) { stop_token.requestStop(); }).get();
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(ExecuteAsync, ExceptionThrown) {
+  auto future { m_impl.executeAsync([](TestIface &) -> int { throw std::runtime_error("Get rekt!"); }) };
+  EXPECT_THAT([&]() { static_cast<void>(future.get()); },
+    ThrowsMessage<std::runtime_error>(HasSubstr("Get rekt!")));
+}
+
+TEST_F_S(ExecuteAsync, DoesNotBlockWhileScheduledCallbackRuns) {
+  std::atomic<bool> started { false };
+  m_impl.schedule([&](auto, auto &stop_token) {
+    started = true;
+    std::this_thread::sleep_for(200ms);
+    stop_token.requestStop();
+  },
+    { .m_sleep_durations = { 1ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+
+  while (!started) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  const auto before { std::chrono::steady_clock::now() };
+  auto future { m_impl.executeAsync([](TestIface &) { return 5; }) };
+  EXPECT_LT(std::chrono::steady_clock::now() - before, 100ms);
+  EXPECT_EQ(future.get(), 5);
+}
+
+TEST_F_S(ExecuteAsync, Executor) {
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>() };
+
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 10; ++i) {
+    futures.push_back(scheduler.executeAsync([i](TestIface &) { return i; }));
+  }
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(futures[i].get(), i);
+  }
+}
+
+TEST_F_S(Coroutine, AwaitExecute) {
+  std::promise<std::vector<std::thread::id>> done;
+  const auto calling_thread_id { std::this_thread::get_id() };
+
+  [](display_device::RetryScheduler<TestIface> &scheduler, std::promise<std::vector<std::thread::id>> &done) -> DetachedTask {
+    std::vector<std::thread::id> resumed_on;
+    const int value { co_await scheduler.awaitExecute([](TestIface &iface) {
+      iface.m_durations.push_back(1);
+      return 5;
+    }) };
+    resumed_on.push_back(std::this_thread::get_id());
+
+    // The interface mutex is not held after resuming
+    co_await scheduler.awaitExecute([value](TestIface &iface) { iface.m_durations.push_back(value); });
+    resumed_on.push_back(std::this_thread::get_id());
+    scheduler.execute([](TestIface &iface) { iface.m_durations.push_back(10); });
+
+    try {
+      co_await scheduler.awaitExecute([](TestIface &) { throw std::runtime_error("Get rekt!"); });
+    }
+    catch (const std::runtime_error &) {
+      scheduler.execute([](TestIface &iface) { iface.m_durations.push_back(20); });
+    }
+
+    done.set_value(resumed_on);
+  }(m_impl, done);
+
+  const auto resumed_on { done.get_future().get() };
+  ASSERT_EQ(resumed_on.size(), 2);
+  EXPECT_NE(resumed_on[0], calling_thread_id);
+  EXPECT_NE(resumed_on[1], calling_thread_id);
+  EXPECT_EQ(m_impl.execute([](TestIface &iface) { return iface.m_durations; }), (std::vector<int> { 1, 5, 10, 20 }));
+}
+
+TEST_F_S(Coroutine, RetryUntil) {
+  std::promise<bool> done;
+  std::atomic<int> counter { 0 };
+
+  [](display_device::RetryScheduler<TestIface> &scheduler, std::promise<bool> &done, std::atomic<int> &counter) -> DetachedTask {
+    const bool result { co_await scheduler.retryUntil([&counter](TestIface &) { return ++counter == 5; }, display_device::FixedBackoff { 1ms }) };
+    done.set_value(result);
+  }(m_impl, done, counter);
+
+  EXPECT_TRUE(done.get_future().get());
+  EXPECT_EQ(counter, 5);
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(Coroutine, RetryUntil, SatisfiedImmediately) {
+  std::promise<bool> done;
+
+  [](display_device::RetryScheduler<TestIface> &scheduler, std::promise<bool> &done) -> DetachedTask {
+    done.set_value(co_await scheduler.retryUntil([](TestIface &) { return true; }, display_device::FixedBackoff { 1000ms }));
+  }(m_impl, done);
+
+  EXPECT_TRUE(done.get_future().get());
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(Coroutine, RetryUntil, Stopped) {
+  std::promise<bool> done;
+
+  [](display_device::RetryScheduler<TestIface> &scheduler, std::promise<bool> &done) -> DetachedTask {
+    done.set_value(co_await scheduler.retryUntil([](TestIface &) { return false; }, display_device::FixedBackoff { 1ms }));
+  }(m_impl, done);
+
+  auto future { done.get_future() };
+  while (!m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(future.wait_for(20ms), std::future_status::timeout);
+
+  m_impl.stop();
+  EXPECT_FALSE(future.get());
+}
+
+TEST_F_S(Coroutine, RetryUntil, Executor) {
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>() };
+  std::promise<bool> done;
+  std::atomic<int> counter { 0 };
+
+  [](display_device::RetryScheduler<TestIface> &scheduler, std::promise<bool> &done, std::atomic<int> &counter) -> DetachedTask {
+    try {
+      static_cast<void>(co_await scheduler.retryUntil([&counter](TestIface &) {
+        if (++counter == 3) {
+          throw std::runtime_error("Get rekt!");
+        }
+        return false;
+      },
+        display_device::FixedBackoff { 1ms }));
+      done.set_value(true);
+    }
+    catch (...) {
+      done.set_exception(std::current_exception());
+    }
+  }(scheduler, done, counter);
+
+  EXPECT_THAT([&]() { static_cast<void>(done.get_future().get()); },
+    ThrowsMessage<std::runtime_error>(HasSubstr("Get rekt!")));
+}
+
+TEST_F_S(TryExecuteFor, NullptrCallbackProvided) {
+  EXPECT_THAT([&]() { static_cast<void>(m_impl.tryExecuteFor(1ms, std::function<void(TestIface &)> {})); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Empty callback function provided in RetryScheduler::tryExecuteFor!")));
+}
+
+TEST_F_S(TryExecuteFor, LockAvailable) {
+  EXPECT_TRUE(m_impl.tryExecuteFor(10ms, [](TestIface &) {}));
+  EXPECT_EQ(m_impl.tryExecuteFor(10ms, [](TestIface &) { return 5; }), std::optional<int> { 5 });
+
+  const auto &const_impl { m_impl };
+  EXPECT_EQ(const_impl.tryExecuteFor(10ms, [](const TestIface &iface) { return iface.m_durations.size(); }), std::optional<std::size_t> { 0 });
+}
+
+TEST_F_S(TryExecuteFor, Timeout) {
+  std::atomic<bool> started { false };
+  m_impl.schedule([&](auto, auto &stop_token) {
+    started = true;
+    std::this_thread::sleep_for(200ms);
+    stop_token.requestStop();
+  },
+    { .m_sleep_durations = { 1ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+
+  while (!started) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  const auto before { std::chrono::steady_clock::now() };
+  EXPECT_FALSE(m_impl.tryExecuteFor(20ms, [](TestIface &) {}));
+  EXPECT_EQ(m_impl.tryExecuteFor(20ms, [](TestIface &) { return 5; }), std::nullopt);
+  EXPECT_LT(std::chrono::steady_clock::now() - before, 150ms);
+
+  EXPECT_EQ(m_impl.tryExecuteFor(1000ms, [](TestIface &) { return 5; }), std::optional<int> { 5 });
+}
+
+TEST_F_S(SharedMutex, ConstExecutionsShareLock) {
+  display_device::RetryScheduler<TestIface, std::shared_timed_mutex> scheduler { std::make_unique<TestIface>() };
+  const auto &const_scheduler { scheduler };
+
+  // Both executions can only finish if they are inside at the same time
+  std::atomic<int> inside { 0 };
+  const auto const_callback { [&inside](const TestIface &) {
+    ++inside;
+    const auto deadline { std::chrono::steady_clock::now() + 1s };
+    while (inside < 2 && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(1ms);
+    }
+    return inside.load();
+  } };
+
+  auto future { std::async(std::launch::async, [&]() { return const_scheduler.execute(const_callback); }) };
+  EXPECT_EQ(const_scheduler.execute(const_callback), 2);
+  EXPECT_EQ(future.get(), 2);
+}
+
+TEST_F_S(SharedMutex, NonConstExecutionIsExclusive) {
+  display_device::RetryScheduler<TestIface, std::shared_timed_mutex> scheduler { std::make_unique<TestIface>() };
+  const auto &const_scheduler { scheduler };
+
+  std::atomic<bool> started { false };
+  auto future { std::async(std::launch::async, [&]() {
+    scheduler.execute([&](TestIface &) {
+      started = true;
+      std::this_thread::sleep_for(100ms);
+    });
+  }) };
+
+  while (!started) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_FALSE(const_scheduler.tryExecuteFor(10ms, [](const TestIface &) {}));
+  future.get();
+  EXPECT_TRUE(const_scheduler.tryExecuteFor(10ms, [](const TestIface &) {}));
+  EXPECT_FALSE(const_scheduler.isScheduled());
+}
+
+TEST_F_S(Metrics) {
+  EXPECT_EQ(m_impl.getMetrics().m_attempts, 0);
+
+  int counter { 0 };
+  m_impl.schedule([&](auto, auto &stop_token) {
+    if (++counter == 3) {
+      stop_token.requestStop();
+    }
+  },
+    { .m_sleep_durations = { 10ms, 1ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  m_impl.schedule([&](auto, auto &) { throw std::runtime_error("Get rekt!"); }, { .m_sleep_durations = { 1ms } });
+  m_impl.execute([](auto &) {});
+
+  const auto metrics { m_impl.getMetrics() };
+  EXPECT_EQ(metrics.m_attempts, 4);
+  EXPECT_EQ(metrics.m_successes, 1);
+  EXPECT_EQ(metrics.m_exceptions, 1);
+  EXPECT_EQ(metrics.m_callback_duration.m_count, 4);
+  EXPECT_EQ(metrics.m_first_run_delay.m_count, 2);
+  EXPECT_GE(metrics.m_first_run_delay.m_max, 9ms);
+  // isScheduled calls are not counted, only the execute call
+  EXPECT_EQ(metrics.m_lock_wait.m_count, 1);
+}
+
 TEST_F_S(Stop) {
   EXPECT_FALSE(m_impl.isScheduled());
   m_impl.stop();
@@ -541,6 +928,727 @@ TEST_F_S(ThreadCleanupInDestructor) {
   EXPECT_EQ(counter_before_sleep, counter_after_sleep);
 }
 
+TEST_F_S(Schedule, BackoffPolicy) {
+  std::vector<int> delays;
+  auto prev = std::chrono::high_resolution_clock::now();
+  m_impl.schedule([&](auto, auto &stop_token) {
+    const auto now = std::chrono::high_resolution_clock::now();
+    delays.push_back(static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(now - prev).count()));
+    prev = now;
+
+    if (delays.size() == 4) {
+      stop_token.requestStop();
+    }
+  },
+    // The durations are ignored when the policy is set
+    { .m_sleep_durations = {}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly, .m_backoff_policy = display_device::ExponentialBackoff { 10ms, 40ms } });
+
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  ASSERT_EQ(delays.size(), 4);
+  EXPECT_GE(delays[0], roundTo99(10));
+  EXPECT_GE(delays[1], roundTo99(20));
+  EXPECT_GE(delays[2], roundTo99(40));
+  EXPECT_GE(delays[3], roundTo99(40));
+}
+
+TEST_F_S(ScheduleJob, NullptrCallbackProvided) {
+  EXPECT_THAT([&]() { static_cast<void>(m_impl.scheduleJob(nullptr, { .m_sleep_durations = { 0ms } })); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Empty callback function provided in RetryScheduler::scheduleJob!")));
+}
+
+TEST_F_S(ScheduleJob, NoDurations) {
+  EXPECT_THAT([&]() { static_cast<void>(m_impl.scheduleJob([](auto, auto &) {}, { .m_sleep_durations = {} })); },
+    ThrowsMessage<std::logic_error>(HasSubstr("At least 1 sleep duration must be specified in RetryScheduler::scheduleJob!")));
+}
+
+TEST_F_S(ScheduleJob, StoppedImmediately) {
+  const auto job_id { m_impl.scheduleJob([&](auto, auto &stop_token) {
+    stop_token.requestStop();
+  },
+    { .m_sleep_durations = { 1000ms } }) };
+
+  EXPECT_FALSE(job_id);
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(ScheduleJob, MultipleJobs) {
+  std::atomic<int> counter_a { 0 };
+  std::atomic<int> counter_b { 0 };
+  std::atomic<int> counter_c { 0 };
+  const auto job_a { m_impl.scheduleJob([&](auto, auto &) { counter_a++; }, { .m_sleep_durations = { 1ms } }) };
+  const auto job_b { m_impl.scheduleJob([&](auto, auto &stop_token) {
+    if (++counter_b == 3) {
+      stop_token.requestStop();
+    }
+  },
+    { .m_sleep_durations = { 5ms } }) };
+  // Does not replace the jobs
+  m_impl.schedule([&](auto, auto &) { counter_c++; }, { .m_sleep_durations = { 2ms } });
+
+  ASSERT_TRUE(job_a);
+  ASSERT_TRUE(job_b);
+  EXPECT_NE(*job_a, *job_b);
+
+  while (m_impl.isScheduled(*job_b) || counter_c < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  // Only the job that requested the stop is gone
+  EXPECT_EQ(counter_b, 3);
+  EXPECT_TRUE(m_impl.isScheduled(*job_a));
+  EXPECT_GT(counter_a, 3);
+
+  EXPECT_TRUE(m_impl.cancel(*job_a));
+  EXPECT_FALSE(m_impl.cancel(*job_a));
+  EXPECT_FALSE(m_impl.isScheduled(*job_a));
+
+  const int counter_a_after_cancel { counter_a };
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(counter_a_after_cancel, counter_a);
+
+  // The replaceable job is still running
+  EXPECT_TRUE(m_impl.isScheduled());
+  m_impl.stop();
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(ScheduleJob, StopStopsAllJobs) {
+  const auto job_a { m_impl.scheduleJob([&](auto, auto &) {}, { .m_sleep_durations = { 1ms } }) };
+  const auto job_b { m_impl.scheduleJob([&](auto, auto &) {}, { .m_sleep_durations = { 1ms } }) };
+  ASSERT_TRUE(job_a);
+  ASSERT_TRUE(job_b);
+
+  m_impl.stop();
+  EXPECT_FALSE(m_impl.isScheduled(*job_a));
+  EXPECT_FALSE(m_impl.isScheduled(*job_b));
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(ScheduleJob, IsScheduledFromCallbacks) {
+  const auto job_id { m_impl.scheduleJob([](auto, auto &) {}, { .m_sleep_durations = { 1h } }) };
+  ASSERT_TRUE(job_id);
+
+  // Does not need the interface mutex which is already held
+  EXPECT_TRUE(m_impl.execute([&](auto) { return m_impl.isScheduled() && m_impl.isScheduled(*job_id); }));
+
+  std::promise<bool> scheduled_from_job;
+  m_impl.schedule([&](auto, auto &stop_token) {
+    scheduled_from_job.set_value(m_impl.isScheduled() && m_impl.isScheduled(*job_id));
+    stop_token.requestStop();
+  },
+    { .m_sleep_durations = { 1ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+
+  auto future { scheduled_from_job.get_future() };
+  ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+  EXPECT_TRUE(future.get());
+}
+
+TEST_F_S(Executor, NullptrExecutorProvided) {
+  EXPECT_THAT([]() { const display_device::RetryScheduler<TestIface> scheduler(std::make_unique<TestIface>(), std::shared_ptr<display_device::SchedulerExecutor> {}); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Nullptr executor provided in RetryScheduler!")));
+}
+
+TEST_F_S(Executor, ManySchedulers) {
+  constexpr int scheduler_count { 32 };
+  const auto executor { std::make_shared<display_device::SchedulerExecutor>() };
+
+  std::array<std::atomic<int>, scheduler_count> counters {};
+  std::vector<std::unique_ptr<display_device::RetryScheduler<TestIface>>> schedulers;
+  for (int i = 0; i < scheduler_count; ++i) {
+    auto &scheduler { schedulers.emplace_back(std::make_unique<display_device::RetryScheduler<TestIface>>(std::make_unique<TestIface>(), executor)) };
+    scheduler->schedule([&counter = counters[i]](auto, auto &stop_token) {
+      if (++counter == 3) {
+        stop_token.requestStop();
+      }
+    },
+      { .m_sleep_durations = { 1ms } });
+  }
+
+  for (const auto &scheduler : schedulers) {
+    while (scheduler->isScheduled()) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  for (const auto &counter : counters) {
+    EXPECT_EQ(counter, 3);
+  }
+}
+
+TEST_F_S(Executor, BusySchedulerDoesNotStallOthers) {
+  const auto executor { std::make_shared<display_device::SchedulerExecutor>(display_device::SchedulerExecutor::Options { .m_thread_count = 1 }) };
+  display_device::RetryScheduler<TestIface> busy_scheduler { std::make_unique<TestIface>(), executor };
+  display_device::RetryScheduler<TestIface> other_scheduler { std::make_unique<TestIface>(), executor };
+
+  std::atomic<int> busy_counter { 0 };
+  busy_scheduler.schedule([&](auto, auto &) { busy_counter++; },
+    { .m_sleep_durations = { 1ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+
+  // Hold the interface mutex of the busy scheduler while its timer keeps expiring
+  std::promise<void> lock_held;
+  std::promise<void> release_lock;
+  std::jthread holder { [&]() {
+    busy_scheduler.execute([&](auto) {
+      lock_held.set_value();
+      release_lock.get_future().wait();
+    });
+  } };
+  lock_held.get_future().wait();
+  const int busy_counter_while_held { busy_counter };
+
+  std::promise<void> other_fired;
+  other_scheduler.schedule([&](auto, auto &stop_token) {
+    other_fired.set_value();
+    stop_token.requestStop();
+  },
+    { .m_sleep_durations = { 10ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+
+  EXPECT_EQ(other_fired.get_future().wait_for(1s), std::future_status::ready);
+  EXPECT_EQ(busy_counter, busy_counter_while_held);
+
+  release_lock.set_value();
+  holder.join();
+  while (busy_counter == busy_counter_while_held) {
+    std::this_thread::sleep_for(1ms);
+  }
+}
+
+TEST_F_S(Executor, SchedulingDurations) {
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>() };
+
+  std::vector<int> durations;
+  auto prev = std::chrono::high_resolution_clock::now();
+  scheduler.schedule([&](auto, auto &stop_token) {
+    const auto now = std::chrono::high_resolution_clock::now();
+    durations.push_back(static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(now - prev).count()));
+    prev = now;
+
+    if (durations.size() == 3) {
+      stop_token.requestStop();
+    }
+  },
+    { .m_sleep_durations = { 50ms, 20ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+
+  while (scheduler.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  ASSERT_EQ(durations.size(), 3);
+  EXPECT_GE(durations[0], roundTo99(50));
+  EXPECT_GE(durations[1], roundTo99(20));
+  EXPECT_GE(durations[2], roundTo99(20));
+}
+
+TEST_F_S(Executor, Stop) {
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), std::make_shared<display_device::SchedulerExecutor>() };
+
+  std::atomic<int> counter { 0 };
+  scheduler.schedule([&](auto, auto &) { counter++; }, { .m_sleep_durations = { 1ms } });
+  while (counter < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_TRUE(scheduler.isScheduled());
+  scheduler.stop();
+  EXPECT_FALSE(scheduler.isScheduled());
+
+  const int counter_before_sleep { counter };
+  std::this_thread::sleep_for(50ms);
+  EXPECT_EQ(counter_before_sleep, counter);
+}
+
+TEST_F_S(Executor, CleanupInDestructor) {
+  const auto executor { std::make_shared<display_device::SchedulerExecutor>() };
+  std::atomic<int> counter { 0 };
+  {
+    display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), executor };
+
+    scheduler.schedule([&](auto, auto &) { counter++; }, { .m_sleep_durations = { 1ms } });
+    while (counter < 3) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  const int counter_before_sleep { counter };
+  std::this_thread::sleep_for(100ms);
+  const int counter_after_sleep { counter };
+
+  EXPECT_EQ(counter_before_sleep, counter_after_sleep);
+}
+
+TEST_F_S(Cadence, FixedDelay) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+
+  std::atomic<int> counter { 0 };
+  std::vector<std::chrono::nanoseconds> call_times;
+  scheduler.schedule([&](auto, auto &stop_token) {
+    call_times.push_back(clock->now().time_since_epoch());
+    clock->advance(300ms);
+    if (++counter == 2) {
+      stop_token.requestStop();
+    }
+  },
+    { .m_sleep_durations = { 1000ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+
+  clock->advance(1000ms);
+  while (counter < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  waitForWaiter(*clock);
+  clock->advance(1000ms);
+  while (scheduler.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(call_times, std::vector<std::chrono::nanoseconds>({ 1000ms, 2300ms }));
+}
+
+TEST_F_S(Cadence, FixedRate) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+
+  std::atomic<int> counter { 0 };
+  std::vector<std::chrono::nanoseconds> call_times;
+  scheduler.schedule([&](auto, auto &stop_token) {
+    call_times.push_back(clock->now().time_since_epoch());
+    clock->advance(300ms);
+    if (++counter == 3) {
+      stop_token.requestStop();
+    }
+  },
+    { .m_sleep_durations = { 1000ms }, .m_execution = display_device::SchedulerOptions::Execution::Immediate, .m_cadence = display_device::SchedulerOptions::Cadence::FixedRate });
+
+  for (int i = 1; i < 3; ++i) {
+    while (counter < i) {
+      std::this_thread::sleep_for(1ms);
+    }
+    waitForWaiter(*clock);
+    clock->advance(700ms);
+  }
+
+  while (scheduler.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(call_times, std::vector<std::chrono::nanoseconds>({ 0ms, 1000ms, 2000ms }));
+}
+
+TEST_F_S(Cadence, FixedRateSkip) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+
+  std::atomic<int> counter { 0 };
+  std::vector<std::chrono::nanoseconds> call_times;
+  scheduler.schedule([&](auto, auto &stop_token) {
+    call_times.push_back(clock->now().time_since_epoch());
+    if (++counter == 1) {
+      clock->advance(2500ms);
+      return;
+    }
+    stop_token.requestStop();
+  },
+    { .m_sleep_durations = { 1000ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly, .m_cadence = display_device::SchedulerOptions::Cadence::FixedRate, .m_catch_up = display_device::SchedulerOptions::CatchUp::Skip });
+
+  clock->advance(1000ms);
+  while (counter < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  waitForWaiter(*clock);
+  clock->advance(500ms);
+  while (scheduler.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(call_times, std::vector<std::chrono::nanoseconds>({ 1000ms, 4000ms }));
+}
+
+TEST_F_S(Cadence, FixedRateBurst) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+
+  std::atomic<int> counter { 0 };
+  std::vector<std::chrono::nanoseconds> call_times;
+  scheduler.schedule([&](auto, auto &stop_token) {
+    call_times.push_back(clock->now().time_since_epoch());
+    if (++counter == 1) {
+      clock->advance(2500ms);
+    }
+    else if (counter == 4) {
+      stop_token.requestStop();
+    }
+  },
+    { .m_sleep_durations = { 1000ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly, .m_cadence = display_device::SchedulerOptions::Cadence::FixedRate, .m_catch_up = display_device::SchedulerOptions::CatchUp::Burst });
+
+  clock->advance(1000ms);
+  while (counter < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  waitForWaiter(*clock);
+  clock->advance(500ms);
+  while (scheduler.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(call_times, std::vector<std::chrono::nanoseconds>({ 1000ms, 3500ms, 3500ms, 4000ms }));
+}
+
+TEST_F_S(Budget, InvalidOptions) {
+  EXPECT_THAT([&]() { m_impl.schedule([](auto, auto &) {}, { .m_sleep_durations = { 1ms }, .m_max_attempts = 0 }); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Maximum attempts must be larger than a 0 in RetryScheduler::schedule!")));
+  EXPECT_THAT([&]() { m_impl.schedule([](auto, auto &) {}, { .m_sleep_durations = { 1ms }, .m_timeout = -1ms }); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Timeout specified in RetryScheduler::schedule must not be negative!")));
+}
+
+TEST_F_S(Budget, MaxAttempts) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+
+  std::atomic<int> counter { 0 };
+  std::promise<std::thread::id> exhausted;
+  scheduler.schedule([&](auto, auto &) { counter++; },
+    { .m_sleep_durations = { 1000ms },
+      .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly,
+      .m_max_attempts = 3,
+      .m_on_exhausted = [&]() { exhausted.set_value(std::this_thread::get_id()); } });
+
+  for (int i = 1; i <= 3; ++i) {
+    waitForWaiter(*clock);
+    clock->advance(1000ms);
+    while (counter < i) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  auto exhausted_future { exhausted.get_future() };
+  ASSERT_EQ(exhausted_future.wait_for(5s), std::future_status::ready);
+  EXPECT_NE(exhausted_future.get(), std::this_thread::get_id());
+  EXPECT_EQ(counter, 3);
+  EXPECT_FALSE(scheduler.isScheduled());
+  EXPECT_EQ(scheduler.getMetrics().m_exhausted, 1);
+}
+
+TEST_F_S(Budget, MaxAttemptsDuringImmediateCall) {
+  int counter { 0 };
+  std::promise<void> exhausted;
+  const auto job_id { m_impl.scheduleJob([&](auto, auto &) { counter++; },
+    { .m_sleep_durations = { 1h }, .m_max_attempts = 1, .m_on_exhausted = [&]() { exhausted.set_value(); } }) };
+
+  EXPECT_FALSE(job_id);
+  EXPECT_EQ(counter, 1);
+  EXPECT_FALSE(m_impl.isScheduled());
+  EXPECT_EQ(exhausted.get_future().wait_for(5s), std::future_status::ready);
+}
+
+TEST_F_S(Budget, Timeout) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+
+  std::atomic<int> counter { 0 };
+  std::promise<std::chrono::nanoseconds> exhausted;
+  scheduler.schedule([&](auto, auto &) { counter++; },
+    { .m_sleep_durations = { 1000ms },
+      .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly,
+      .m_timeout = 2500ms,
+      .m_on_exhausted = [&]() { exhausted.set_value(clock->now().time_since_epoch()); } });
+
+  for (int i = 1; i <= 2; ++i) {
+    waitForWaiter(*clock);
+    clock->advance(1000ms);
+    while (counter < i) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  auto exhausted_future { exhausted.get_future() };
+  ASSERT_EQ(exhausted_future.wait_for(5s), std::future_status::ready);
+  EXPECT_EQ(exhausted_future.get(), 2000ms);
+  EXPECT_EQ(counter, 2);
+  EXPECT_FALSE(scheduler.isScheduled());
+}
+
+TEST_F_S(Budget, NotExhaustedOnSuccess) {
+  int counter { 0 };
+  bool exhausted { false };
+  m_impl.schedule([&](auto, auto &stop_token) {
+    if (++counter == 2) {
+      stop_token.requestStop();
+    }
+  },
+    { .m_sleep_durations = { 1ms }, .m_max_attempts = 2, .m_on_exhausted = [&]() { exhausted = true; } });
+
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  // Synchronize with the scheduler thread
+  m_impl.execute([](auto) {});
+  EXPECT_EQ(counter, 2);
+  EXPECT_FALSE(exhausted);
+  EXPECT_EQ(m_impl.getMetrics().m_exhausted, 0);
+}
+
+TEST_F_S(Budget, Executor) {
+  const auto executor { std::make_shared<display_device::SchedulerExecutor>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), executor };
+
+  std::atomic<int> counter { 0 };
+  std::promise<void> exhausted;
+  scheduler.schedule([&](auto, auto &) { counter++; },
+    { .m_sleep_durations = { 1ms }, .m_max_attempts = 3, .m_on_exhausted = [&]() { exhausted.set_value(); } });
+
+  EXPECT_EQ(exhausted.get_future().wait_for(5s), std::future_status::ready);
+  EXPECT_EQ(counter, 3);
+  EXPECT_FALSE(scheduler.isScheduled());
+}
+
+TEST_F_S(Coalesce, InvalidOptions) {
+  EXPECT_THAT([&]() { m_impl.schedule([](auto, auto &) {}, { .m_sleep_durations = { 1ms }, .m_coalesce_window = -1ms }); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Coalescing window specified in RetryScheduler::schedule must not be negative!")));
+}
+
+TEST_F_S(Coalesce, Schedule) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+  const display_device::SchedulerOptions options { .m_sleep_durations = { 5000ms }, .m_coalesce_window = 1000ms, .m_coalesce_key = "display" };
+
+  std::array<std::atomic<int>, 3> counters {};
+  scheduler.schedule([&](auto, auto &) { counters[0]++; }, options);
+  clock->advance(500ms);
+  scheduler.schedule([&](auto, auto &) { counters[1]++; }, options);
+  scheduler.schedule([&](auto, auto &) { counters[2]++; }, options);
+
+  EXPECT_EQ(counters[0], 1);
+  EXPECT_EQ(counters[1], 0);
+  EXPECT_EQ(counters[2], 0);
+
+  // The deadline of the first call is kept, while the latest function is executed
+  waitForWaiter(*clock);
+  clock->advance(4500ms);
+  while (counters[2] < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(counters[0], 1);
+  EXPECT_EQ(counters[1], 0);
+  EXPECT_TRUE(scheduler.isScheduled());
+}
+
+TEST_F_S(Coalesce, WindowExpired) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+  const display_device::SchedulerOptions options { .m_sleep_durations = { 5000ms }, .m_coalesce_window = 1000ms };
+
+  int counter_a { 0 };
+  int counter_b { 0 };
+  scheduler.schedule([&](auto, auto &) { counter_a++; }, options);
+  clock->advance(1000ms);
+  scheduler.schedule([&](auto, auto &) { counter_b++; }, options);
+
+  EXPECT_EQ(counter_a, 1);
+  EXPECT_EQ(counter_b, 1);
+}
+
+TEST_F_S(Coalesce, FinishedImmediately) {
+  int counter { 0 };
+  const display_device::SchedulerOptions options { .m_sleep_durations = { 1ms }, .m_coalesce_window = 1h };
+  for (int i = 0; i < 5; ++i) {
+    m_impl.schedule([&](auto, auto &stop_token) {
+      counter++;
+      stop_token.requestStop();
+    },
+      options);
+  }
+
+  EXPECT_EQ(counter, 1);
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(Coalesce, FailedImmediately) {
+  int counter { 0 };
+  const display_device::SchedulerOptions options { .m_sleep_durations = { 1h }, .m_coalesce_window = 1h };
+
+  m_impl.schedule([&](auto, auto &) {
+    counter++;
+    throw std::runtime_error("Get rekt!");
+  },
+    options);
+  m_impl.schedule([&](auto, auto &) { counter++; }, options);
+
+  EXPECT_EQ(counter, 2);
+  EXPECT_TRUE(m_impl.isScheduled());
+}
+
+TEST_F_S(Coalesce, FailedInThread) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+  const display_device::SchedulerOptions options { .m_sleep_durations = { 100ms }, .m_coalesce_window = 1h };
+
+  std::atomic<int> counter { 0 };
+  const auto job_id { scheduler.scheduleJob([&](auto, auto &) {
+    if (++counter > 1) {
+      throw std::runtime_error("Get rekt!");
+    }
+  },
+    options) };
+  ASSERT_TRUE(job_id);
+
+  waitForWaiter(*clock);
+  clock->advance(100ms);
+  while (scheduler.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  const auto new_job_id { scheduler.scheduleJob([&](auto, auto &) { counter++; }, options) };
+  ASSERT_TRUE(new_job_id);
+  EXPECT_NE(*job_id, *new_job_id);
+  EXPECT_EQ(counter, 3);
+}
+
+TEST_F_S(Coalesce, Exhausted) {
+  int counter { 0 };
+  const display_device::SchedulerOptions options { .m_sleep_durations = { 1h }, .m_max_attempts = 1, .m_coalesce_window = 1h };
+
+  EXPECT_FALSE(m_impl.scheduleJob([&](auto, auto &) { counter++; }, options));
+  EXPECT_FALSE(m_impl.scheduleJob([&](auto, auto &) { counter++; }, options));
+  EXPECT_EQ(counter, 2);
+}
+
+TEST_F_S(Coalesce, ScheduleJobKeys) {
+  int counter { 0 };
+  const auto schedule_job { [&](const std::string &key) {
+    return m_impl.scheduleJob([&](auto, auto &) { counter++; }, { .m_sleep_durations = { 1h }, .m_coalesce_window = 1h, .m_coalesce_key = key });
+  } };
+
+  const auto job_a { schedule_job("a") };
+  const auto job_b { schedule_job("b") };
+  const auto job_a_again { schedule_job("a") };
+
+  ASSERT_TRUE(job_a);
+  ASSERT_TRUE(job_b);
+  EXPECT_NE(*job_a, *job_b);
+  EXPECT_EQ(job_a, job_a_again);
+  EXPECT_EQ(counter, 2);
+}
+
+TEST_F_S(Coalesce, AfterCancel) {
+  int counter { 0 };
+  const display_device::SchedulerOptions options { .m_sleep_durations = { 1h }, .m_coalesce_window = 1h };
+
+  const auto job_id { m_impl.scheduleJob([&](auto, auto &) { counter++; }, options) };
+  ASSERT_TRUE(job_id);
+  EXPECT_TRUE(m_impl.cancel(*job_id));
+
+  const auto new_job_id { m_impl.scheduleJob([&](auto, auto &) { counter++; }, options) };
+  ASSERT_TRUE(new_job_id);
+  EXPECT_NE(*job_id, *new_job_id);
+  EXPECT_EQ(counter, 2);
+}
+
+TEST_F_S(WakeNow, ThenBackoff) {
+  const auto clock { std::make_shared<display_device::ManualSchedulerClock>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), clock };
+
+  std::atomic<int> counter { 0 };
+  std::vector<std::chrono::nanoseconds> call_times;
+  scheduler.schedule([&](auto, auto &) {
+    call_times.push_back(clock->now().time_since_epoch());
+    counter++;
+  },
+    { .m_sleep_durations = { 5000ms, 1000ms }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+
+  waitForWaiter(*clock);
+  scheduler.wakeNow();
+  while (counter < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  waitForWaiter(*clock);
+  clock->advance(1000ms);
+  while (counter < 2) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  scheduler.stop();
+  EXPECT_EQ(call_times, std::vector<std::chrono::nanoseconds>({ 0ms, 1000ms }));
+}
+
+TEST_F_S(WakeNow, NothingScheduled) {
+  EXPECT_NO_THROW(m_impl.wakeNow());
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(WakeNow, FromScheduledFunction) {
+  std::atomic<int> counter { 0 };
+  m_impl.schedule([&](auto, auto &stop_token) {
+    if (++counter == 3) {
+      stop_token.requestStop();
+      return;
+    }
+    m_impl.wakeNow();
+  },
+    { .m_sleep_durations = { 1h } });
+
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(counter, 3);
+}
+
+TEST_F_S(WakeNow, Executor) {
+  const auto executor { std::make_shared<display_device::SchedulerExecutor>() };
+  display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>(), executor };
+
+  std::atomic<int> counter { 0 };
+  scheduler.schedule([&](auto, auto &) { counter++; }, { .m_sleep_durations = { 1h }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+  scheduler.wakeNow();
+
+  while (counter < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_TRUE(scheduler.isScheduled());
+}
+
+TEST_F_S(EventSource, NullptrEventSourceProvided) {
+  EXPECT_THAT([&]() { m_impl.addEventSource(nullptr); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Nullptr event source provided in RetryScheduler::addEventSource!")));
+}
+
+TEST_F_S(EventSource, Notify) {
+  const auto event_source { std::make_shared<display_device::ManualSchedulerEventSource>() };
+  m_impl.addEventSource(event_source);
+
+  std::atomic<int> counter { 0 };
+  m_impl.schedule([&](auto, auto &) { counter++; }, { .m_sleep_durations = { 1h }, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly });
+
+  event_source->notify();
+  while (counter < 1) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  event_source->notify();
+  while (counter < 2) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_TRUE(m_impl.isScheduled());
+}
+
+TEST_F_S(EventSource, OutlivesScheduler) {
+  const auto event_source { std::make_shared<display_device::ManualSchedulerEventSource>() };
+  {
+    display_device::RetryScheduler<TestIface> scheduler { std::make_unique<TestIface>() };
+    scheduler.addEventSource(event_source);
+  }
+
+  EXPECT_NO_THROW(event_source->notify());
+}
+
 TEST_F_S(SchedulerStopToken, DestructorNoThrow) {
   EXPECT_NO_THROW({
     display_device::SchedulerStopToken token { []() {} };
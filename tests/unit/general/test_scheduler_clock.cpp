@@ -0,0 +1,106 @@
+// system includes
+#include <gmock/gmock.h>
+#include <thread>
+
+// local includes
+#include "display_device/scheduler_clock.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, SchedulerClock, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Steady, Now) {
+  display_device::SteadySchedulerClock clock;
+  const auto before { std::chrono::steady_clock::now() };
+  const auto now { clock.now() };
+  EXPECT_GE(now, before);
+  EXPECT_LE(now, std::chrono::steady_clock::now());
+  EXPECT_EQ(clock.subscribe([]() {}), nullptr);
+}
+
+TEST_S(Manual, Advance) {
+  const auto start { display_device::SchedulerClock::time_point { 10s } };
+  display_device::ManualSchedulerClock clock { start };
+  EXPECT_EQ(clock.now(), start);
+
+  clock.advance(5ms);
+  EXPECT_EQ(clock.now(), start + 5ms);
+
+  clock.sleepFor(1s);
+  EXPECT_EQ(clock.now(), start + 1005ms);
+
+  clock.advance(-1s);
+  clock.advance(0s);
+  EXPECT_EQ(clock.now(), start + 1005ms);
+}
+
+TEST_S(Manual, Subscription) {
+  display_device::ManualSchedulerClock clock;
+
+  int counter { 0 };
+  auto subscription { clock.subscribe([&]() { counter++; }) };
+  ASSERT_NE(subscription, nullptr);
+
+  clock.advance(1ms);
+  clock.advance(0ms);
+  EXPECT_EQ(counter, 1);
+
+  subscription.reset();
+  clock.advance(1ms);
+  EXPECT_EQ(counter, 1);
+}
+
+TEST_S(Manual, WaitUntil) {
+  display_device::ManualSchedulerClock clock;
+  std::mutex mutex;
+  std::condition_variable cv;
+  const auto subscription { clock.subscribe([&]() {
+    std::lock_guard lock { mutex };
+    cv.notify_all();
+  }) };
+
+  std::optional<bool> result;
+  std::thread waiter { [&]() {
+    std::unique_lock lock { mutex };
+    result = clock.waitUntil(cv, lock, clock.now() + 1h, []() { return false; });
+  } };
+
+  while (clock.getWaiterCount() == 0) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  clock.advance(59min);
+  EXPECT_EQ(clock.getWaiterCount(), 1);
+
+  clock.advance(1min);
+  waiter.join();
+  EXPECT_EQ(result, false);
+  EXPECT_EQ(clock.getWaiterCount(), 0);
+}
+
+TEST_S(Manual, WaitUntilPredicate) {
+  display_device::ManualSchedulerClock clock;
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool ready { false };
+
+  std::optional<bool> result;
+  std::thread waiter { [&]() {
+    std::unique_lock lock { mutex };
+    result = clock.waitUntil(cv, lock, clock.now() + 1h, [&]() { return ready; });
+  } };
+
+  {
+    std::lock_guard lock { mutex };
+    ready = true;
+    cv.notify_all();
+  }
+
+  waiter.join();
+  EXPECT_EQ(result, true);
+  EXPECT_EQ(clock.now(), display_device::SchedulerClock::time_point {});
+}
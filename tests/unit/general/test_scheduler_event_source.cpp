@@ -0,0 +1,32 @@
+// system includes
+#include <gmock/gmock.h>
+
+// local includes
+#include "display_device/scheduler_event_source.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, SchedulerEventSource, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Manual, Notify) {
+  display_device::ManualSchedulerEventSource event_source;
+  EXPECT_NO_THROW(event_source.notify());
+
+  int counter_a { 0 };
+  int counter_b { 0 };
+  auto subscription_a { event_source.subscribe([&]() { counter_a++; }) };
+  auto subscription_b { event_source.subscribe([&]() { counter_b++; }) };
+  ASSERT_NE(subscription_a, nullptr);
+  ASSERT_NE(subscription_b, nullptr);
+
+  event_source.notify();
+  EXPECT_EQ(counter_a, 1);
+  EXPECT_EQ(counter_b, 1);
+
+  subscription_a.reset();
+  event_source.notify();
+  EXPECT_EQ(counter_a, 1);
+  EXPECT_EQ(counter_b, 2);
+}
@@ -0,0 +1,176 @@
+// system includes
+#include <atomic>
+#include <gmock/gmock.h>
+#include <thread>
+
+// local includes
+#include "display_device/scheduler_executor.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class SchedulerExecutorTest: public BaseTest {
+  public:
+    template <class Predicate>
+    [[nodiscard]] static bool
+    waitFor(Predicate predicate, const std::chrono::milliseconds timeout = 5000ms) {
+      const auto deadline { std::chrono::steady_clock::now() + timeout };
+      while (!predicate()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+          return false;
+        }
+        std::this_thread::sleep_for(1ms);
+      }
+      return true;
+    }
+
+    display_device::SchedulerExecutor m_impl;
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, SchedulerExecutorTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(InvalidOptionsProvided) {
+  EXPECT_THAT([]() { const display_device::SchedulerExecutor executor { { .m_thread_count = 0 } }; },
+    ThrowsMessage<std::logic_error>(HasSubstr("Thread count must be larger than 0 in SchedulerExecutor!")));
+  EXPECT_THAT([]() { const display_device::SchedulerExecutor executor { { .m_tick_duration = 0ms } }; },
+    ThrowsMessage<std::logic_error>(HasSubstr("Tick duration must be larger than 0 in SchedulerExecutor!")));
+  EXPECT_THAT([]() { const display_device::SchedulerExecutor executor { { .m_wheel_size = 0 } }; },
+    ThrowsMessage<std::logic_error>(HasSubstr("Wheel size must be larger than 0 in SchedulerExecutor!")));
+}
+
+TEST_F_S(CreateTimer, NullptrCallbackProvided) {
+  EXPECT_THAT([&]() { static_cast<void>(m_impl.createTimer(nullptr)); },
+    ThrowsMessage<std::logic_error>(HasSubstr("Empty callback function provided in SchedulerExecutor::createTimer!")));
+}
+
+TEST_F_S(Arm, ExpiresAfterDeadline) {
+  std::atomic<std::chrono::steady_clock::time_point> fired_at {};
+  const auto timer { m_impl.createTimer([&]() { fired_at = std::chrono::steady_clock::now(); }) };
+
+  const auto deadline { std::chrono::steady_clock::now() + 30ms };
+  timer->arm(deadline);
+
+  ASSERT_TRUE(waitFor([&]() { return fired_at.load() != std::chrono::steady_clock::time_point {}; }));
+  EXPECT_GE(fired_at.load(), deadline);
+}
+
+TEST_F_S(Arm, BeyondWheelRotation) {
+  display_device::SchedulerExecutor executor { { .m_tick_duration = 1ms, .m_wheel_size = 4 } };
+
+  std::atomic<std::chrono::steady_clock::time_point> fired_at {};
+  const auto timer { executor.createTimer([&]() { fired_at = std::chrono::steady_clock::now(); }) };
+
+  const auto deadline { std::chrono::steady_clock::now() + 30ms };
+  timer->arm(deadline);
+
+  ASSERT_TRUE(waitFor([&]() { return fired_at.load() != std::chrono::steady_clock::time_point {}; }));
+  EXPECT_GE(fired_at.load(), deadline);
+}
+
+TEST_F_S(Arm, ReplacesDeadline) {
+  std::atomic<int> counter { 0 };
+  const auto timer { m_impl.createTimer([&]() { counter++; }) };
+
+  timer->arm(std::chrono::steady_clock::now() + 20ms);
+  timer->arm(std::chrono::steady_clock::now() + 40ms);
+
+  ASSERT_TRUE(waitFor([&]() { return counter > 0; }));
+  std::this_thread::sleep_for(50ms);
+  EXPECT_EQ(counter, 1);
+}
+
+TEST_F_S(Arm, FromCallback) {
+  std::atomic<int> counter { 0 };
+  std::unique_ptr<display_device::SchedulerExecutor::Timer> timer;
+  timer = m_impl.createTimer([&]() {
+    if (++counter < 5) {
+      timer->arm(std::chrono::steady_clock::now() + 1ms);
+    }
+  });
+
+  timer->arm(std::chrono::steady_clock::now());
+  ASSERT_TRUE(waitFor([&]() { return counter == 5; }));
+}
+
+TEST_F_S(Disarm) {
+  std::atomic<int> counter { 0 };
+  const auto timer { m_impl.createTimer([&]() { counter++; }) };
+
+  timer->arm(std::chrono::steady_clock::now() + 20ms);
+  timer->disarm();
+
+  std::this_thread::sleep_for(50ms);
+  EXPECT_EQ(counter, 0);
+}
+
+TEST_F_S(NoConcurrentCallbacks) {
+  std::atomic<int> running { 0 };
+  std::atomic<int> max_running { 0 };
+  std::atomic<int> counter { 0 };
+  std::unique_ptr<display_device::SchedulerExecutor::Timer> timer;
+  timer = m_impl.createTimer([&]() {
+    max_running = std::max(max_running.load(), ++running);
+    // Re-arming while running must not start the callback on the other worker
+    timer->arm(std::chrono::steady_clock::now());
+    std::this_thread::sleep_for(5ms);
+    counter++;
+    running--;
+  });
+
+  timer->arm(std::chrono::steady_clock::now());
+  ASSERT_TRUE(waitFor([&]() { return counter >= 5; }));
+  timer->disarm();
+
+  EXPECT_EQ(max_running, 1);
+}
+
+TEST_F_S(Destroy, WaitsForRunningCallback) {
+  std::atomic<bool> started { false };
+  std::atomic<bool> finished { false };
+  auto timer { m_impl.createTimer([&]() {
+    started = true;
+    std::this_thread::sleep_for(50ms);
+    finished = true;
+  }) };
+
+  timer->arm(std::chrono::steady_clock::now());
+  ASSERT_TRUE(waitFor([&]() { return started.load(); }));
+
+  timer.reset();
+  EXPECT_TRUE(finished);
+}
+
+TEST_F_S(Destroy, FromOwnCallback) {
+  std::atomic<bool> destroyed { false };
+  std::unique_ptr<display_device::SchedulerExecutor::Timer> timer;
+  timer = m_impl.createTimer([&]() {
+    timer.reset();
+    destroyed = true;
+  });
+
+  timer->arm(std::chrono::steady_clock::now());
+  ASSERT_TRUE(waitFor([&]() { return destroyed.load(); }));
+}
+
+TEST_F_S(ManyTimers) {
+  constexpr int timer_count { 1000 };
+  std::atomic<int> counter { 0 };
+
+  std::vector<std::unique_ptr<display_device::SchedulerExecutor::Timer>> timers;
+  const auto now { std::chrono::steady_clock::now() };
+  for (int i = 0; i < timer_count; ++i) {
+    timers.push_back(m_impl.createTimer([&]() { counter++; }));
+    timers.back()->arm(now + std::chrono::milliseconds { i % 50 });
+  }
+
+  ASSERT_TRUE(waitFor([&]() { return counter == timer_count; }));
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(counter, timer_count);
+}
@@ -0,0 +1,100 @@
+// system includes
+#include <gmock/gmock.h>
+#include <thread>
+
+// local includes
+#include "display_device/scheduler_metrics.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, SchedulerMetrics, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Histogram, Buckets) {
+  display_device::LatencyHistogram histogram;
+  histogram.record(0us);
+  histogram.record(1us);
+  histogram.record(3us);
+  histogram.record(1000us);
+  histogram.record(-5us);
+  histogram.record(std::chrono::hours { 10 });
+
+  const auto snapshot { histogram.getSnapshot() };
+  EXPECT_EQ(snapshot.m_count, 6);
+  EXPECT_EQ(snapshot.m_buckets[0], 2);
+  EXPECT_EQ(snapshot.m_buckets[1], 1);
+  EXPECT_EQ(snapshot.m_buckets[2], 1);
+  EXPECT_EQ(snapshot.m_buckets[10], 1);
+  EXPECT_EQ(snapshot.m_buckets.back(), 1);
+  EXPECT_EQ(snapshot.m_max, std::chrono::hours { 10 });
+  EXPECT_EQ(snapshot.m_total, std::chrono::hours { 10 } + 1004us);
+}
+
+TEST_S(Histogram, UpperBound) {
+  using Snapshot = display_device::LatencyHistogram::Snapshot;
+  EXPECT_EQ(Snapshot::getUpperBound(0), 1us);
+  EXPECT_EQ(Snapshot::getUpperBound(1), 2us);
+  EXPECT_EQ(Snapshot::getUpperBound(10), 1024us);
+  EXPECT_EQ(Snapshot::getUpperBound(display_device::LatencyHistogram::m_bucket_count - 1), std::chrono::microseconds::max());
+}
+
+TEST_S(Histogram, Percentile) {
+  display_device::LatencyHistogram histogram;
+  EXPECT_EQ(histogram.getSnapshot().getPercentile(50), 0us);
+
+  for (int i = 0; i < 99; ++i) {
+    histogram.record(3us);
+  }
+  histogram.record(1500us);
+
+  const auto snapshot { histogram.getSnapshot() };
+  EXPECT_EQ(snapshot.getPercentile(0), 4us);
+  EXPECT_EQ(snapshot.getPercentile(50), 4us);
+  EXPECT_EQ(snapshot.getPercentile(99), 4us);
+  EXPECT_EQ(snapshot.getPercentile(100), 1500us);
+}
+
+TEST_S(Histogram, MultipleThreads) {
+  display_device::LatencyHistogram histogram;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&histogram, i]() {
+      for (int j = 0; j < 1000; ++j) {
+        histogram.record(std::chrono::microseconds { i });
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  const auto snapshot { histogram.getSnapshot() };
+  EXPECT_EQ(snapshot.m_count, 4000);
+  EXPECT_EQ(snapshot.m_total, 6000us);
+  EXPECT_EQ(snapshot.m_max, 3us);
+}
+
+TEST_S(Attempts) {
+  display_device::SchedulerMetrics metrics;
+  metrics.recordAttempt(display_device::SchedulerMetrics::Outcome::Retry, 1ms);
+  metrics.recordAttempt(display_device::SchedulerMetrics::Outcome::Retry, 1ms);
+  metrics.recordAttempt(display_device::SchedulerMetrics::Outcome::Success, 1ms);
+  metrics.recordAttempt(display_device::SchedulerMetrics::Outcome::Exception, 1ms);
+  metrics.recordExhausted();
+  metrics.recordLockWait(5ms);
+  metrics.recordFirstRunDelay(7ms);
+
+  const auto snapshot { metrics.getSnapshot() };
+  EXPECT_EQ(snapshot.m_attempts, 4);
+  EXPECT_EQ(snapshot.m_successes, 1);
+  EXPECT_EQ(snapshot.m_exceptions, 1);
+  EXPECT_EQ(snapshot.m_exhausted, 1);
+  EXPECT_EQ(snapshot.m_callback_duration.m_count, 4);
+  EXPECT_EQ(snapshot.m_callback_duration.m_total, 4ms);
+  EXPECT_EQ(snapshot.m_lock_wait.m_max, 5ms);
+  EXPECT_EQ(snapshot.m_first_run_delay.m_max, 7ms);
+}